@@ -15,6 +15,35 @@
 #define LCD_u8RW_PIN			DIO_u8PIN1
 #define LCD_u8E_PIN			    DIO_u8PIN2
 
+/* Data bus width:
+ * - LCD_u8BUS_8BIT: DB0..DB7 on all of LCD_u8Data_PORT.
+ * - LCD_u8BUS_4BIT: DB4..DB7 on the four pins below (DB0..DB3 unconnected), written with masked
+ *   writes so the other four pins of LCD_u8Data_PORT are free for other uses. */
+#define LCD_u8BUS_MODE          LCD_u8BUS_4BIT
+
+#define LCD_u8D4_PIN            DIO_u8PIN4
+#define LCD_u8D5_PIN            DIO_u8PIN5
+#define LCD_u8D6_PIN            DIO_u8PIN6
+#define LCD_u8D7_PIN            DIO_u8PIN7
+
+/* Display geometry, for the shadow framebuffer (rows 2 and 3 of 4-row displays follow rows 0 and 1 in DDRAM) */
+#define LCD_u8ROWS              2u
+#define LCD_u8COLUMNS           16u
+
+/* Busy flag reads before a write goes ahead anyway, about 1.5 us each (covers the 1.52 ms clear) */
+#define LCD_u16BusyTimeOut      4000u
+
+/* Transfer mode:
+ * - LCD_u8BLOCKING: every write waits for the controller before it returns.
+ * - LCD_u8ASYNC: writes go into a queue, sent by the Timer/Counter2 compare match ISR one byte per tick
+ *   once the busy flag has cleared, so LCD calls return at once. Uses Timer/Counter2. */
+#define LCD_u8TRANSFER_MODE     LCD_u8ASYNC
+
+/* Queue length in bytes, a power of two (64 holds a full 2x16 redraw with its address commands) */
+#define LCD_u8QUEUE_SIZE        64u
+
+/* Ticks a busy display may hold the queue before the next byte is sent anyway (covers the 1.52 ms clear) */
+#define LCD_u8BusyTicks         40u
 
 
 
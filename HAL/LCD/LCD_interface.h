@@ -10,10 +10,10 @@
 #include "STD_types.h"
 
 /**
- * @brief Initializes the character LCD in 4-bit mode.
+ * @brief Initializes the character LCD.
  * 
- * This function configures the LCD to operate in 4-bit mode and sets the necessary LCD parameters
- * such as display control, entry mode, and clearing the display.
+ * This function configures the LCD to operate in the 8-bit or 4-bit mode selected by LCD_u8BUS_MODE
+ * and sets the necessary LCD parameters such as display control, entry mode, and clearing the display.
  * 
  * @param None
  * @return None
@@ -24,7 +24,9 @@ void CLCD_voidInit(void);
  * @brief Sends a command to the LCD.
  * 
  * This function sends a command byte to the LCD to control its operations (e.g., clearing the display, 
- * setting the cursor position).
+ * setting the cursor position). In the blocking mode it waits for the busy flag of the previous
+ * instruction instead of a fixed delay; in the asynchronous mode it only queues the byte. The
+ * framebuffer does not know what the command did, so the next flush rewrites every cell.
  * 
  * @param copy_u8command The 8-bit command to be sent to the LCD.
  * @return None
@@ -32,9 +34,11 @@ void CLCD_voidInit(void);
 void CLCD_voidSendCommand(u8 copy_u8command);
 
 /**
- * @brief Sends a data byte to the LCD for display.
+ * @brief Writes a character to the LCD framebuffer.
  * 
- * This function sends a character to be displayed on the LCD at the current cursor position.
+ * This function writes a character at the current cursor position of the framebuffer and moves the
+ * cursor to the next column. Characters past the end of the row are dropped, as they would land in
+ * the hidden part of the display. Nothing is sent to the LCD until CLCD_voidFlush is called.
  * 
  * @param copy_u8data The 8-bit data (character) to be displayed.
  * @return None
@@ -55,8 +59,9 @@ void CLCD_voidSendString(const char* Copy_pcString);
 /**
  * @brief Moves the LCD cursor to a specific position.
  * 
- * This function sets the cursor position on the LCD. The position is determined by the (X, Y) coordinates,
- * where X is the row (0 or 1) and Y is the column (0 to 15).
+ * This function sets the cursor position of the framebuffer. The position is determined by the (X, Y)
+ * coordinates, where X is the row (0 to LCD_u8ROWS - 1) and Y is the column (0 to LCD_u8COLUMNS - 1).
+ * Following writes are dropped until the next call if the position is off the screen.
  * 
  * @param Copy_u8XPos The row position (0 for the first row, 1 for the second row).
  * @param Copy_u8YPos The column position (0-15).
@@ -67,8 +72,10 @@ void CLCD_voidGoToXY(u8 Copy_u8XPos, u8 Copy_u8YPos);
 /**
  * @brief Displays a custom character on the LCD.
  * 
- * This function writes a custom character (defined by an 8-byte array) to the LCD's CGRAM, then displays it 
- * at the specified (X, Y) position. The custom character is identified by a block number (0-7).
+ * This function writes a custom character (defined by an 8-byte array) to the LCD's CGRAM, then writes it 
+ * to the framebuffer at the specified (X, Y) position. The custom character is identified by a block number (0-7).
+ * The CGRAM upload is sent right away; the character itself is shown by the next flush. The block is
+ * taken out of the glyph cache, as its pattern is no longer a cached glyph.
  * 
  * @param Copy_u8ArrayPtr Pointer to the 8-byte array defining the custom character.
  * @param Copy_u8BlockNum The CGRAM block number (0-7) to store the custom character.
@@ -78,6 +85,41 @@ void CLCD_voidGoToXY(u8 Copy_u8XPos, u8 Copy_u8YPos);
  */
 void CLCD_voidDisplaySpecialCharacter(u8* Copy_u8ArrayPtr, u8 Copy_u8BlockNum, u8 Copy_XPos, u8 Copy_YPos);
 
+/**
+ * @brief Glyph ID that is never cached (marks a CGRAM slot without a glyph).
+ */
+#define CLCD_NO_GLYPH       0xFFu
+
+/**
+ * @brief Gets the character code of a glyph, loading it into CGRAM if needed.
+ * 
+ * The 8 CGRAM slots are a cache of glyphs identified by the caller's glyph IDs. On a hit nothing is
+ * sent; on a miss the least recently used slot is given to the glyph and its pattern is uploaded.
+ * With more than 8 glyphs in use, a glyph still on the screen may be evicted: the cells showing it
+ * then show the new glyph, so screens should not show more than 8 glyphs at once.
+ * 
+ * @param Copy_u8GlyphId The glyph ID chosen by the caller (0-254), one per pattern.
+ * @param Copy_pu8Pattern Pointer to the 8-byte pattern of the glyph.
+ * @param Copy_pu8Code Pointer to the character code (0-7) showing the glyph.
+ * @return NO_ERROR, NULL_PTR_ERR, or ERROR for the CLCD_NO_GLYPH ID.
+ */
+u8 CLCD_u8LoadGlyph(u8 Copy_u8GlyphId, const u8* Copy_pu8Pattern, u8* Copy_pu8Code);
+
+/**
+ * @brief Displays a cached glyph at a specific position.
+ * 
+ * This function gets the character code of the glyph through the glyph cache and writes it to the
+ * framebuffer at the (X, Y) position. Once the glyph is in CGRAM, showing it costs a single data byte
+ * at the next flush, and nothing while the cell does not change.
+ * 
+ * @param Copy_u8GlyphId The glyph ID chosen by the caller (0-254), one per pattern.
+ * @param Copy_pu8Pattern Pointer to the 8-byte pattern of the glyph.
+ * @param Copy_XPos The row position (0 or 1).
+ * @param Copy_YPos The column position (0-15).
+ * @return None
+ */
+void CLCD_voidDisplayGlyph(u8 Copy_u8GlyphId, const u8* Copy_pu8Pattern, u8 Copy_XPos, u8 Copy_YPos);
+
 /**
  * @brief Displays a number on the LCD.
  * 
@@ -92,12 +134,39 @@ void CLCD_voidDisplayNumber(u32 Copy_u32Number);
 /**
  * @brief Clears the LCD screen.
  * 
- * This function sends a command to the LCD to clear its display and reset the cursor to the home position.
+ * This function fills the framebuffer with spaces and returns the cursor to the home position. Only the
+ * cells that were not blank are sent by the next flush.
  * 
  * @param None
  * @return None
  */
 void CLCD_voidClearScreen(void);
 
+/**
+ * @brief Sends the framebuffer changes to the LCD.
+ * 
+ * Text written with CLCD_voidSendData, CLCD_voidSendString, CLCD_voidDisplayNumber and
+ * CLCD_voidClearScreen only changes a RAM copy of the screen. This function sends the cells that
+ * differ from what the display shows, moving the address counter only at the start of each run of
+ * changed cells. An unchanged screen costs nothing on the bus.
+ * 
+ * @param None
+ * @return None
+ */
+void CLCD_voidFlush(void);
+
+/**
+ * @brief Waits until every queued LCD write has been executed.
+ * 
+ * With LCD_u8TRANSFER_MODE set to LCD_u8ASYNC, commands and data are queued and sent by the
+ * Timer/Counter2 ISR, so LCD calls return before the display has changed. This function sends what
+ * is left from the caller and returns once the display is up to date, for the rare callers that need
+ * the ordering. In the blocking mode it only waits for the last instruction.
+ * 
+ * @param None
+ * @return None
+ */
+void CLCD_voidWaitQueue(void);
+
 
 #endif /* LCD_INTERFACE_H_ */
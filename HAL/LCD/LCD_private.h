@@ -9,8 +9,171 @@
 #ifndef LCD_PRIVATE_H_
 #define LCD_PRIVATE_H_
 
+#if !defined(DIO_u8PORTA) || !defined(PORTA)
+#error "DIO_interface.h and DIO_Register.h must be included before LCD_private.h"
+#endif
 
+/* PORTx, DDRx and PINx of the configured ports, from the DIO registers, so the bus is driven with single
+ * sbi/cbi/in/out instructions instead of a DIO call per pin */
+#if LCD_u8Data_PORT == DIO_u8PORTA
+#define LCD_DATA_PORT         PORTA
+#define LCD_DATA_DDR          DDRA
+#define LCD_DATA_PIN          PINA
+#elif LCD_u8Data_PORT == DIO_u8PORTB
+#define LCD_DATA_PORT         PORTB
+#define LCD_DATA_DDR          DDRB
+#define LCD_DATA_PIN          PINB
+#elif LCD_u8Data_PORT == DIO_u8PORTC
+#define LCD_DATA_PORT         PORTC
+#define LCD_DATA_DDR          DDRC
+#define LCD_DATA_PIN          PINC
+#elif LCD_u8Data_PORT == DIO_u8PORTD
+#define LCD_DATA_PORT         PORTD
+#define LCD_DATA_DDR          DDRD
+#define LCD_DATA_PIN          PIND
+#else
+#error "LCD_u8Data_PORT must be one of DIO_u8PORTA .. DIO_u8PORTD"
+#endif
 
+#if LCD_u8CLR_PORT == DIO_u8PORTA
+#define LCD_CTRL_PORT         PORTA
+#define LCD_CTRL_DDR          DDRA
+#elif LCD_u8CLR_PORT == DIO_u8PORTB
+#define LCD_CTRL_PORT         PORTB
+#define LCD_CTRL_DDR          DDRB
+#elif LCD_u8CLR_PORT == DIO_u8PORTC
+#define LCD_CTRL_PORT         PORTC
+#define LCD_CTRL_DDR          DDRC
+#elif LCD_u8CLR_PORT == DIO_u8PORTD
+#define LCD_CTRL_PORT         PORTD
+#define LCD_CTRL_DDR          DDRD
+#else
+#error "LCD_u8CLR_PORT must be one of DIO_u8PORTA .. DIO_u8PORTD"
+#endif
 
+/* Register select values */
+#define LCD_RS_COMMAND          0u
+#define LCD_RS_DATA             1u
+
+/* Data bus widths */
+#define LCD_u8BUS_8BIT          0u
+#define LCD_u8BUS_4BIT          1u
+
+#if (LCD_u8BUS_MODE != LCD_u8BUS_8BIT) && (LCD_u8BUS_MODE != LCD_u8BUS_4BIT)
+#error "LCD_u8BUS_MODE must be LCD_u8BUS_8BIT or LCD_u8BUS_4BIT"
+#endif
+
+/* Data port pins of DB4..DB7 in the 4-bit mode; when they are consecutive, a nibble is only shifted into place */
+#define LCD_NIBBLE_MASK         ((u8)((1u << LCD_u8D4_PIN) | (1u << LCD_u8D5_PIN) | (1u << LCD_u8D6_PIN) | (1u << LCD_u8D7_PIN)))
+#define LCD_NIBBLE_CONSECUTIVE  ((LCD_u8D5_PIN == (LCD_u8D4_PIN + 1u)) && (LCD_u8D6_PIN == (LCD_u8D4_PIN + 2u)) && (LCD_u8D7_PIN == (LCD_u8D4_PIN + 3u)))
+
+/* Instructions */
+#define LCD_CLEAR_DISPLAY       0x01u
+#define LCD_FUNCTION_SET_8BIT   0x38u   /* 8-bit bus, 2 lines, 5x8 dots */
+#define LCD_FUNCTION_SET_4BIT   0x28u   /* 4-bit bus, 2 lines, 5x8 dots */
+#define LCD_RESET_NIBBLE        0x03u   /* High nibble of an 8-bit function set, for the reset by instruction */
+#define LCD_4BIT_NIBBLE         0x02u   /* High nibble of a 4-bit function set */
+#define LCD_SET_CGRAM_ADDRESS   0x40u
+#define LCD_SET_DDRAM_ADDRESS   0x80u
+
+/* Glyph cache: the 8 CGRAM slots of 5x8 characters, shown by the character codes 0..7 */
+#define LCD_CGRAM_SLOTS         8u
+#define LCD_GLYPH_ROWS          8u
+
+/* Shadow framebuffer: cells are stored row after row */
+#define LCD_FRAME_SIZE          (LCD_u8ROWS * LCD_u8COLUMNS)
+#define LCD_NO_CELL             0xFFu   /* DDRAM address counter not on a known cell */
+
+/* DDRAM address of the first cell of a row: rows 0 and 1 start at 0x00 and 0x40, rows 2 and 3 continue them */
+#define LCD_ROW_ADDRESS(ROW)    ((((ROW) & 1u) != 0u ? 0x40u : 0x00u) + (((ROW) >> 1) * LCD_u8COLUMNS))
+
+#if (LCD_u8ROWS == 0u) || (LCD_u8ROWS > 4u) || (LCD_u8COLUMNS == 0u) || (LCD_u8COLUMNS > 40u) || (LCD_FRAME_SIZE > 80u)
+#error "LCD geometry must fit the 80 DDRAM cells of the HD44780, in 1 to 4 rows"
+#endif
+
+/* Transfer modes */
+#define LCD_u8BLOCKING          0u
+#define LCD_u8ASYNC             1u
+
+/* Queue entries: register select in the high byte, command or data byte in the low byte */
+#define LCD_QUEUE_MASK          (LCD_u8QUEUE_SIZE - 1u)
+#define LCD_QUEUE_ENTRY(BYTE, MODE)     ((u16)(((u16)(MODE) << 8) | (u8)(BYTE)))
+
+#if (LCD_u8TRANSFER_MODE != LCD_u8BLOCKING) && (LCD_u8TRANSFER_MODE != LCD_u8ASYNC)
+#error "LCD_u8TRANSFER_MODE must be LCD_u8BLOCKING or LCD_u8ASYNC"
+#endif
+
+#if (LCD_u8QUEUE_SIZE < 2u) || ((LCD_u8QUEUE_SIZE & LCD_QUEUE_MASK) != 0u)
+#error "LCD_u8QUEUE_SIZE must be a power of two, from 2 to 128"
+#endif
+
+/* Busy flag bit of the busy flag/address read */
+#define LCD_BUSY_FLAG_BIT       7u
+
+/* E high time and data delay of the datasheet (450 ns and 360 ns at 5 V) rounded up to 0.5 us, in CPU cycles.
+ * The pulse is a constant cycle count: it runs in the Timer/Counter2 ISR, where _delay_us would compute its
+ * loop count in floating point at run time in the -O0 build */
+#define LCD_E_PULSE_CYCLES      ((F_CPU + 1999999UL) / 2000000UL)
+#define LCD_E_PULSE()           __builtin_avr_delay_cycles(LCD_E_PULSE_CYCLES)
+
+/**
+ * @brief Reads the busy flag of the LCD controller once.
+ *
+ * @return The busy flag: 1 while the controller executes an instruction, 0 when it is ready.
+ */
+static u8 CLCD_u8ReadBusyFlag(void);
+
+/**
+ * @brief Waits until the LCD controller is ready for the next instruction.
+ *
+ * Reads the busy flag until it clears or LCD_u16BusyTimeOut reads have been made.
+ */
+static void CLCD_voidWaitBusy(void);
+
+/**
+ * @brief Puts one byte on the bus, without checking the busy flag.
+ *
+ * @param Copy_u8Byte The command or data byte.
+ * @param Copy_u8Mode LCD_RS_COMMAND or LCD_RS_DATA.
+ */
+static void CLCD_voidWriteBus(u8 Copy_u8Byte, u8 Copy_u8Mode);
+
+#if LCD_u8BUS_MODE == LCD_u8BUS_4BIT
+/**
+ * @brief Puts a nibble on DB4..DB7 and pulses E.
+ *
+ * @param Copy_u8Nibble The nibble, in the low 4 bits.
+ */
+static void CLCD_voidWriteNibble(u8 Copy_u8Nibble);
+#endif
+
+/**
+ * @brief Writes one byte to the LCD controller, right away or through the queue.
+ *
+ * @param Copy_u8Byte The command or data byte.
+ * @param Copy_u8Mode LCD_RS_COMMAND or LCD_RS_DATA.
+ */
+static void CLCD_voidWriteByte(u8 Copy_u8Byte, u8 Copy_u8Mode);
+
+/**
+ * @brief Marks a CGRAM slot as the most recently used one.
+ *
+ * @param Copy_u8Slot The slot (0-7).
+ */
+static void CLCD_voidTouchSlot(u8 Copy_u8Slot);
+
+#if LCD_u8TRANSFER_MODE == LCD_u8ASYNC
+/**
+ * @brief Sends the oldest queued byte from the caller, once the controller is ready.
+ *
+ * The Timer/Counter2 interrupt must be disabled by the caller.
+ */
+static void CLCD_voidSendQueued(void);
+
+/**
+ * @brief Timer/Counter2 compare match callback sending the queue.
+ */
+static void CLCD_voidQueueTick(void);
+#endif
 
 #endif /* LCD_PRIVATE_H_ */
\ No newline at end of file
@@ -5,71 +5,83 @@
 /***************************************************************/
 
 #include "BIT_math.h"
+#include "STD_types.h"
+#include "DIO_interface.h"
+#include "DIO_Register.h"
 #include "LCD_config.h"
 #include "LCD_interface.h"
 #include "LCD_private.h"
-#include "STD_types.h"
-#include "DIO_interface.h"
+#include "TIMER_interface.h"
 #define F_CPU 16000000UL
 #include "util/delay.h"
 
+/* Shadow framebuffer: the text the application wrote, and what the display currently shows */
+static u8 CLCD_au8Frame[LCD_FRAME_SIZE];
+static u8 CLCD_au8Screen[LCD_FRAME_SIZE];
+static u8 CLCD_u8ScreenValid = 0u;          // 0 when the display contents are unknown
+static u8 CLCD_u8Row = 0u;                  // Write position in the framebuffer
+static u8 CLCD_u8Column = 0u;
+static u8 CLCD_u8AddressCell = LCD_NO_CELL; // Cell the DDRAM address counter points to
+
+/* Glyph cache: the glyph ID held by each CGRAM slot, and the slot ages (0 = most recently used) */
+static u8 CLCD_au8SlotGlyph[LCD_CGRAM_SLOTS];
+static u8 CLCD_au8SlotAge[LCD_CGRAM_SLOTS];
+
+#if LCD_u8TRANSFER_MODE == LCD_u8ASYNC
+/* Transmit queue: filled by the LCD calls (head), sent by the Timer/Counter2 ISR (tail) */
+static volatile u16 CLCD_au16Queue[LCD_u8QUEUE_SIZE];
+static volatile u8 CLCD_u8QueueHead = 0u;
+static volatile u8 CLCD_u8QueueTail = 0u;
+static u8 CLCD_u8BusyTickCount = 0u;
+#endif
+
 
 /**
  * @brief Sends a command to the LCD.
  * 
  * This function sends a command byte to the LCD to control its operations (e.g., clearing the display, 
- * setting the cursor position).
+ * setting the cursor position). In the blocking mode it waits for the busy flag of the previous
+ * instruction instead of a fixed delay; in the asynchronous mode it only queues the byte. The
+ * framebuffer does not know what the command did, so the next flush rewrites every cell.
  * 
  * @param copy_u8command The 8-bit command to be sent to the LCD.
  * @return None
  */
 void CLCD_voidSendCommand   (u8 copy_u8command)
 {
+	CLCD_voidWriteByte(copy_u8command, LCD_RS_COMMAND);
 
-	DIO_u8_SetPinValue(LCD_u8CLR_PORT,LCD_u8RW_PIN,DIO_u8PIN_LOW);  // Set RW pin to LOW (Write mode)
-
-	DIO_u8_SetPinValue(LCD_u8CLR_PORT,LCD_u8RS_PIN,DIO_u8PIN_LOW);  // Set RS pin to LOW (Command mode)
-
-	DIO_u8_SetPortValue(LCD_u8Data_PORT,copy_u8command);            // Send the command to the data port
-
-	DIO_u8_SetPinValue(LCD_u8CLR_PORT,LCD_u8E_PIN,DIO_u8PIN_HIGH);  // Enable the E pin
-
-	_delay_ms(2);                                                   // Delay to ensure command is processed
-
-	DIO_u8_SetPinValue(LCD_u8CLR_PORT,LCD_u8E_PIN,DIO_u8PIN_LOW);    // Disable the E pin
+	/* The command may have changed the display or the address counter: the next flush redraws every cell */
+	CLCD_u8ScreenValid = 0u;
+	CLCD_u8AddressCell = LCD_NO_CELL;
 }
 
 
 
 /**
- * @brief Sends a data byte to the LCD for display.
+ * @brief Writes a character to the LCD framebuffer.
  * 
- * This function sends a character to be displayed on the LCD at the current cursor position.
+ * This function writes a character at the current cursor position of the framebuffer and moves the
+ * cursor to the next column. Characters past the end of the row are dropped, as they would land in
+ * the hidden part of the display. Nothing is sent to the LCD until CLCD_voidFlush is called.
  * 
  * @param copy_u8data The 8-bit data (character) to be displayed.
  * @return None
  */
 void CLCD_voidSendData  (u8 copy_u8data)
 {
-
-	DIO_u8_SetPinValue(LCD_u8CLR_PORT,LCD_u8RW_PIN,DIO_u8PIN_LOW);   // Set RW pin to LOW (Write mode)
-
-	DIO_u8_SetPinValue(LCD_u8CLR_PORT,LCD_u8RS_PIN,DIO_u8PIN_HIGH);  // Set RS pin to HIGH (Data mode)
-
-	DIO_u8_SetPortValue(LCD_u8Data_PORT,copy_u8data);                // Send the data to the data port
-
-	DIO_u8_SetPinValue(LCD_u8CLR_PORT,LCD_u8E_PIN,DIO_u8PIN_HIGH);   // Enable the E pin
-
-	_delay_ms(2);                                                    // Delay to ensure command is processed
-
-	DIO_u8_SetPinValue(LCD_u8CLR_PORT,LCD_u8E_PIN,DIO_u8PIN_LOW);    // Disable the E pin
+	if (CLCD_u8Column < LCD_u8COLUMNS)
+	{
+		CLCD_au8Frame[(CLCD_u8Row * LCD_u8COLUMNS) + CLCD_u8Column] = copy_u8data;
+		CLCD_u8Column++;
+	}
 }
 
 /**
- * @brief Initializes the character LCD in 4-bit mode.
+ * @brief Initializes the character LCD.
  * 
- * This function configures the LCD to operate in 4-bit mode and sets the necessary LCD parameters
- * such as display control, entry mode, and clearing the display.
+ * This function configures the LCD to operate in the 8-bit or 4-bit mode selected by LCD_u8BUS_MODE
+ * and sets the necessary LCD parameters such as display control, entry mode, and clearing the display.
  * 
  * @param None
  * @return None
@@ -77,15 +89,66 @@ void CLCD_voidSendData  (u8 copy_u8data)
 void CLCD_voidInit (void)
 {
 
-	DIO_u8_SetPortDirection(LCD_u8Data_PORT, DIO_u8PORT_OUTPUT);   // Set data port direction to output
-	DIO_u8_SetPortDirection(LCD_u8CLR_PORT, DIO_u8PORT_OUTPUT);   // Set control port direction to output
+#if LCD_u8BUS_MODE == LCD_u8BUS_4BIT
+	LCD_DATA_DDR |= LCD_NIBBLE_MASK;   // Set the DB4..DB7 pins direction to output
+#else
+	LCD_DATA_DDR = DIO_u8PORT_OUTPUT;   // Set data port direction to output
+#endif
+	SET_BIT(LCD_CTRL_DDR, LCD_u8RS_PIN);   // Set the control pins direction to output,
+	SET_BIT(LCD_CTRL_DDR, LCD_u8RW_PIN);   // leaving the rest of the control port alone
+	SET_BIT(LCD_CTRL_DDR, LCD_u8E_PIN);
+	CLR_BIT(LCD_CTRL_PORT, LCD_u8E_PIN);
+	CLR_BIT(LCD_CTRL_PORT, LCD_u8RS_PIN);
+	CLR_BIT(LCD_CTRL_PORT, LCD_u8RW_PIN);
+
+#if LCD_u8TRANSFER_MODE == LCD_u8ASYNC
+	/* The queue is sent from the Timer/Counter2 tick once global interrupts are enabled */
+	CLCD_u8QueueHead = 0u;
+	CLCD_u8QueueTail = 0u;
+	TIMER2_u8SetCallBack(&CLCD_voidQueueTick);
+	TIMER2_voidInit();
+#endif
 
 	_delay_ms(40);  // Delay to allow LCD to stabilize after power on
 
-	CLCD_voidSendCommand(0x38);      // Set LCD to 8-bit mode
+#if LCD_u8BUS_MODE == LCD_u8BUS_4BIT
+	/* Reset by instruction: the controller may be in either mode, and its busy flag cannot be read
+	 * yet, so three 8-bit function sets go out as single nibbles with the datasheet delays, then
+	 * the switch to the 4-bit mode */
+	CLCD_voidWriteNibble(LCD_RESET_NIBBLE);
+	_delay_ms(5);
+	CLCD_voidWriteNibble(LCD_RESET_NIBBLE);
+	_delay_us(100);
+	CLCD_voidWriteNibble(LCD_RESET_NIBBLE);
+	_delay_us(100);
+	CLCD_voidWriteNibble(LCD_4BIT_NIBBLE);
+	_delay_us(100);
+
+	CLCD_voidSendCommand(LCD_FUNCTION_SET_4BIT);      // Set LCD to 4-bit mode
+#else
+	CLCD_voidSendCommand(LCD_FUNCTION_SET_8BIT);      // Set LCD to 8-bit mode
+#endif
 	CLCD_voidSendCommand(0x0C);     // Turn on the display and hide the cursor
 	CLCD_voidSendCommand(0x01);    // Clear the display
 	CLCD_voidSendCommand(0x06);   // Set entry mode (increment address, no shift)
+
+	/* The display is blank with the address counter on the first cell */
+	for (u8 Local_u8Cell = 0; Local_u8Cell < LCD_FRAME_SIZE; Local_u8Cell++)
+	{
+		CLCD_au8Frame[Local_u8Cell] = ' ';
+		CLCD_au8Screen[Local_u8Cell] = ' ';
+	}
+	CLCD_u8ScreenValid = 1u;
+	CLCD_u8AddressCell = 0u;
+	CLCD_u8Row = 0u;
+	CLCD_u8Column = 0u;
+
+	/* CGRAM holds no known glyph after reset; the ages start as a valid LRU order that fills slot 0 first */
+	for (u8 Local_u8Slot = 0; Local_u8Slot < LCD_CGRAM_SLOTS; Local_u8Slot++)
+	{
+		CLCD_au8SlotGlyph[Local_u8Slot] = CLCD_NO_GLYPH;
+		CLCD_au8SlotAge[Local_u8Slot] = (u8)(LCD_CGRAM_SLOTS - 1u - Local_u8Slot);
+	}
 }
 
 
@@ -111,8 +174,9 @@ void CLCD_voidSendString   (const char* Copy_pcString)
 /**
  * @brief Moves the LCD cursor to a specific position.
  * 
- * This function sets the cursor position on the LCD. The position is determined by the (X, Y) coordinates,
- * where X is the row (0 or 1) and Y is the column (0 to 15).
+ * This function sets the cursor position of the framebuffer. The position is determined by the (X, Y)
+ * coordinates, where X is the row (0 to LCD_u8ROWS - 1) and Y is the column (0 to LCD_u8COLUMNS - 1).
+ * Following writes are dropped until the next call if the position is off the screen.
  * 
  * @param Copy_u8XPos The row position (0 for the first row, 1 for the second row).
  * @param Copy_u8YPos The column position (0-15).
@@ -120,23 +184,24 @@ void CLCD_voidSendString   (const char* Copy_pcString)
  */
 void CLCD_voidGoToXY(u8 Xpos  ,u8 Ypos)
 {
-	u8 add = 0;
-	if(Xpos == 0)
+	if (Xpos < LCD_u8ROWS)
 	{
-		add = Ypos;
+		CLCD_u8Row = Xpos;
+		CLCD_u8Column = Ypos;
 	}
-	else if(Xpos == 1)
+	else
 	{
-		add = Ypos+ 0x40 ;
+		CLCD_u8Column = LCD_u8COLUMNS;
 	}
-	CLCD_voidSendCommand(add + 128);   // Send command to move the cursor
 }
 
 /**
  * @brief Displays a custom character on the LCD.
  * 
- * This function writes a custom character (defined by an 8-byte array) to the LCD's CGRAM, then displays it 
- * at the specified (X, Y) position. The custom character is identified by a block number (0-7).
+ * This function writes a custom character (defined by an 8-byte array) to the LCD's CGRAM, then writes it 
+ * to the framebuffer at the specified (X, Y) position. The custom character is identified by a block number (0-7).
+ * The CGRAM upload is sent right away; the character itself is shown by the next flush. The block is
+ * taken out of the glyph cache, as its pattern is no longer a cached glyph.
  * 
  * @param Copy_u8ArrayPtr Pointer to the 8-byte array defining the custom character.
  * @param Copy_u8BlockNum The CGRAM block number (0-7) to store the custom character.
@@ -148,16 +213,108 @@ void CLCD_voidDisplaySpecialCharacter(u8* Copy_u8ArrayPtr, u8 Copy_u8BlockNum, u
 {
 	u8 add = 0;
 	add = 8 * Copy_u8BlockNum;           // Calculate address in CGRAM
-	CLCD_voidSendCommand(add + 64);      // Send command to set CGRAM address
+	CLCD_voidWriteByte(add + LCD_SET_CGRAM_ADDRESS, LCD_RS_COMMAND);      // Send command to set CGRAM address
 	for (u8 Local_u8Counter = 0; Local_u8Counter < 8; Local_u8Counter++) 
 	{
-		CLCD_voidSendData(Copy_u8ArrayPtr[Local_u8Counter]); // Send custom character data
+		CLCD_voidWriteByte(Copy_u8ArrayPtr[Local_u8Counter], LCD_RS_DATA); // Send custom character data
+	}
+	CLCD_u8AddressCell = LCD_NO_CELL;        // The address counter is in CGRAM now
+	if (Copy_u8BlockNum < LCD_CGRAM_SLOTS)
+	{
+		CLCD_au8SlotGlyph[Copy_u8BlockNum] = CLCD_NO_GLYPH;
 	}
 	CLCD_voidGoToXY(Copy_XPos, Copy_YPos);  // Move cursor to specified position
 	CLCD_voidSendData(Copy_u8BlockNum);     // Display the custom character
 
 }
 
+/**
+ * @brief Gets the character code of a glyph, loading it into CGRAM if needed.
+ * 
+ * This function looks the glyph ID up in the 8 CGRAM slots. On a hit nothing is sent; on a miss the
+ * least recently used slot is given to the glyph and its pattern is uploaded (a CGRAM address command
+ * and 8 data bytes). The returned code can then be written like any character.
+ * 
+ * @param Copy_u8GlyphId The glyph ID chosen by the caller (0-254), one per pattern.
+ * @param Copy_pu8Pattern Pointer to the 8-byte pattern of the glyph.
+ * @param Copy_pu8Code Pointer to the character code (0-7) showing the glyph.
+ * @return NO_ERROR, NULL_PTR_ERR, or ERROR for the CLCD_NO_GLYPH ID.
+ */
+u8 CLCD_u8LoadGlyph(u8 Copy_u8GlyphId, const u8* Copy_pu8Pattern, u8* Copy_pu8Code)
+{
+	u8 Local_u8ErrorState = NO_ERROR;
+	u8 Local_u8Slot = LCD_CGRAM_SLOTS;
+
+	if ((Copy_pu8Pattern == NULL) || (Copy_pu8Code == NULL))
+	{
+		Local_u8ErrorState = NULL_PTR_ERR;
+	}
+	else if (Copy_u8GlyphId == CLCD_NO_GLYPH)
+	{
+		Local_u8ErrorState = ERROR;
+	}
+	else
+	{
+		/* Hit: the glyph is already in a slot */
+		for (u8 Local_u8Index = 0; Local_u8Index < LCD_CGRAM_SLOTS; Local_u8Index++)
+		{
+			if (CLCD_au8SlotGlyph[Local_u8Index] == Copy_u8GlyphId)
+			{
+				Local_u8Slot = Local_u8Index;
+			}
+		}
+
+		/* Miss: upload the pattern into the least recently used slot */
+		if (Local_u8Slot == LCD_CGRAM_SLOTS)
+		{
+			for (u8 Local_u8Index = 0; Local_u8Index < LCD_CGRAM_SLOTS; Local_u8Index++)
+			{
+				if (CLCD_au8SlotAge[Local_u8Index] == (LCD_CGRAM_SLOTS - 1u))
+				{
+					Local_u8Slot = Local_u8Index;
+				}
+			}
+
+			CLCD_voidWriteByte((u8)(LCD_SET_CGRAM_ADDRESS + (Local_u8Slot * LCD_GLYPH_ROWS)), LCD_RS_COMMAND);
+			for (u8 Local_u8Row = 0; Local_u8Row < LCD_GLYPH_ROWS; Local_u8Row++)
+			{
+				CLCD_voidWriteByte(Copy_pu8Pattern[Local_u8Row], LCD_RS_DATA);
+			}
+			CLCD_u8AddressCell = LCD_NO_CELL;    // The address counter is in CGRAM now
+			CLCD_au8SlotGlyph[Local_u8Slot] = Copy_u8GlyphId;
+		}
+
+		CLCD_voidTouchSlot(Local_u8Slot);
+		*Copy_pu8Code = Local_u8Slot;
+	}
+
+	return Local_u8ErrorState;
+}
+
+/**
+ * @brief Displays a cached glyph at a specific position.
+ * 
+ * This function gets the character code of the glyph through the glyph cache and writes it to the
+ * framebuffer at the (X, Y) position. Once the glyph is in CGRAM, showing it costs a single data byte
+ * at the next flush, and nothing while the cell does not change.
+ * 
+ * @param Copy_u8GlyphId The glyph ID chosen by the caller (0-254), one per pattern.
+ * @param Copy_pu8Pattern Pointer to the 8-byte pattern of the glyph.
+ * @param Copy_XPos The row position (0 or 1).
+ * @param Copy_YPos The column position (0-15).
+ * @return None
+ */
+void CLCD_voidDisplayGlyph(u8 Copy_u8GlyphId, const u8* Copy_pu8Pattern, u8 Copy_XPos, u8 Copy_YPos)
+{
+	u8 Local_u8Code;
+
+	if (CLCD_u8LoadGlyph(Copy_u8GlyphId, Copy_pu8Pattern, &Local_u8Code) == NO_ERROR)
+	{
+		CLCD_voidGoToXY(Copy_XPos, Copy_YPos);
+		CLCD_voidSendData(Local_u8Code);
+	}
+}
+
 /**
  * @brief Displays a number on the LCD.
  * 
@@ -197,21 +354,299 @@ void CLCD_voidDisplayNumber(u32 Copy_u32Number)
 /**
  * @brief Clears the LCD screen.
  * 
- * This function sends a command to the LCD to clear its display and reset the cursor to the home position.
+ * This function fills the framebuffer with spaces and returns the cursor to the home position. Only the
+ * cells that were not blank are sent by the next flush.
  * 
  * @param None
  * @return None
  */
 void CLCD_voidClearScreen(void)
 {
-	/* Clear the first row */
-	CLCD_voidGoToXY(0, 0);
-	CLCD_voidSendString("                ");
-	
-	/* Clear the second row */
-	CLCD_voidGoToXY(1, 0);
-	CLCD_voidSendString("                ");
-	
+	for (u8 Local_u8Cell = 0; Local_u8Cell < LCD_FRAME_SIZE; Local_u8Cell++)
+	{
+		CLCD_au8Frame[Local_u8Cell] = ' ';
+	}
+
 	/* Return the cursor to the home position */
 	CLCD_voidGoToXY(0, 0);
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Sends the framebuffer changes to the LCD.
+ * 
+ * This function sends only the cells that differ from what the display shows, with a DDRAM address
+ * command only where the address counter is not already on the next changed cell (the start of each
+ * run of changed cells in a row). An unchanged screen costs nothing on the bus.
+ * 
+ * @param None
+ * @return None
+ */
+void CLCD_voidFlush(void)
+{
+	u8 Local_u8Cell = 0u;
+
+	for (u8 Local_u8Row = 0; Local_u8Row < LCD_u8ROWS; Local_u8Row++)
+	{
+		for (u8 Local_u8Column = 0; Local_u8Column < LCD_u8COLUMNS; Local_u8Column++)
+		{
+			if ((CLCD_u8ScreenValid == 0u) || (CLCD_au8Frame[Local_u8Cell] != CLCD_au8Screen[Local_u8Cell]))
+			{
+				if (CLCD_u8AddressCell != Local_u8Cell)
+				{
+					CLCD_voidWriteByte(LCD_SET_DDRAM_ADDRESS + LCD_ROW_ADDRESS(Local_u8Row) + Local_u8Column, LCD_RS_COMMAND);
+				}
+				CLCD_voidWriteByte(CLCD_au8Frame[Local_u8Cell], LCD_RS_DATA);
+				CLCD_au8Screen[Local_u8Cell] = CLCD_au8Frame[Local_u8Cell];
+
+				/* The address counter moves to the next column, which is not the next row for the last one */
+				CLCD_u8AddressCell = (Local_u8Column == (LCD_u8COLUMNS - 1u)) ? LCD_NO_CELL : (u8)(Local_u8Cell + 1u);
+			}
+			Local_u8Cell++;
+		}
+	}
+
+	CLCD_u8ScreenValid = 1u;
+}
+
+/**
+ * @brief Waits until every queued LCD write has been executed.
+ * 
+ * In the asynchronous mode, this function sends what is left in the queue from the caller, then waits
+ * for the last instruction. It is for the rare callers that need the display up to date before they go
+ * on (for example before disabling interrupts for a long time). In the blocking mode it only waits for
+ * the last instruction.
+ * 
+ * @param None
+ * @return None
+ */
+void CLCD_voidWaitQueue(void)
+{
+#if LCD_u8TRANSFER_MODE == LCD_u8ASYNC
+	TIMER2_voidDisableInterrupt();
+	while (CLCD_u8QueueTail != CLCD_u8QueueHead)
+	{
+		CLCD_voidSendQueued();
+	}
+#endif
+
+	CLCD_voidWaitBusy();
+}
+
+/**
+ * Function: CLCD_voidTouchSlot
+ * ----------------------------
+ * The slot ages are a permutation of 0..7: the used slot becomes 0 and the slots that were more
+ * recently used than it age by one, so the slot aged 7 is always the least recently used one.
+ */
+static void CLCD_voidTouchSlot(u8 Copy_u8Slot)
+{
+	u8 Local_u8Age = CLCD_au8SlotAge[Copy_u8Slot];
+
+	for (u8 Local_u8Index = 0; Local_u8Index < LCD_CGRAM_SLOTS; Local_u8Index++)
+	{
+		if (CLCD_au8SlotAge[Local_u8Index] < Local_u8Age)
+		{
+			CLCD_au8SlotAge[Local_u8Index]++;
+		}
+	}
+	CLCD_au8SlotAge[Copy_u8Slot] = 0u;
+}
+
+/**
+ * Function: CLCD_u8ReadBusyFlag
+ * -----------------------------
+ * Switches the data pins to input and reads the busy flag/address register (RS low, RW high) with one
+ * E pulse, or two in the 4-bit mode where the busy flag comes with the high nibble on DB7. The data
+ * pins are left as input; CLCD_voidWriteBus turns them back to output.
+ */
+static u8 CLCD_u8ReadBusyFlag(void)
+{
+	u8 Local_u8Busy;
+
+#if LCD_u8BUS_MODE == LCD_u8BUS_4BIT
+	LCD_DATA_DDR &= (u8)~LCD_NIBBLE_MASK;
+	LCD_DATA_PORT &= (u8)~LCD_NIBBLE_MASK;     // No pull-ups on the data lines
+#else
+	LCD_DATA_DDR = DIO_u8PORT_INPUT;
+	LCD_DATA_PORT = 0u;                         // No pull-ups on the data lines
+#endif
+	CLR_BIT(LCD_CTRL_PORT, LCD_u8RS_PIN);
+	SET_BIT(LCD_CTRL_PORT, LCD_u8RW_PIN);
+
+	SET_BIT(LCD_CTRL_PORT, LCD_u8E_PIN);
+	LCD_E_PULSE();                                              // Data delay time after E rises
+#if LCD_u8BUS_MODE == LCD_u8BUS_4BIT
+	Local_u8Busy = GET_BIT(LCD_DATA_PIN, LCD_u8D7_PIN);
+	CLR_BIT(LCD_CTRL_PORT, LCD_u8E_PIN);
+	LCD_E_PULSE();
+
+	/* The low nibble (address counter bits) completes the read cycle, and is not used */
+	SET_BIT(LCD_CTRL_PORT, LCD_u8E_PIN);
+	LCD_E_PULSE();
+	CLR_BIT(LCD_CTRL_PORT, LCD_u8E_PIN);
+#else
+	Local_u8Busy = GET_BIT(LCD_DATA_PIN, LCD_BUSY_FLAG_BIT);
+	CLR_BIT(LCD_CTRL_PORT, LCD_u8E_PIN);
+#endif
+
+	CLR_BIT(LCD_CTRL_PORT, LCD_u8RW_PIN);
+	LCD_E_PULSE();                                              // E low time before the next pulse
+
+	return Local_u8Busy;
+}
+
+/**
+ * Function: CLCD_voidWaitBusy
+ * ---------------------------
+ * Reads the busy flag until it clears or LCD_u16BusyTimeOut reads have been made, so that a missing
+ * display does not hang the caller.
+ */
+static void CLCD_voidWaitBusy(void)
+{
+	u16 Local_u16Counter = 0u;
+
+	while ((CLCD_u8ReadBusyFlag() != 0u) && (Local_u16Counter < LCD_u16BusyTimeOut))
+	{
+		Local_u16Counter++;
+	}
+}
+
+/**
+ * Function: CLCD_voidWriteBus
+ * ---------------------------
+ * Sets RS, drives the byte on the data port and pulses E for the datasheet width, or sends it as two
+ * nibbles (high first) in the 4-bit mode. The controller latches the byte on the falling edge of E and
+ * raises its busy flag until the instruction is executed.
+ */
+static void CLCD_voidWriteBus(u8 Copy_u8Byte, u8 Copy_u8Mode)
+{
+	if (Copy_u8Mode == LCD_RS_DATA)
+	{
+		SET_BIT(LCD_CTRL_PORT, LCD_u8RS_PIN);
+	}
+	else
+	{
+		CLR_BIT(LCD_CTRL_PORT, LCD_u8RS_PIN);
+	}
+
+#if LCD_u8BUS_MODE == LCD_u8BUS_4BIT
+	LCD_DATA_DDR |= LCD_NIBBLE_MASK;
+	CLCD_voidWriteNibble((u8)(Copy_u8Byte >> 4));
+	CLCD_voidWriteNibble(Copy_u8Byte);
+#else
+	LCD_DATA_PORT = Copy_u8Byte;
+	LCD_DATA_DDR = DIO_u8PORT_OUTPUT;
+
+	SET_BIT(LCD_CTRL_PORT, LCD_u8E_PIN);
+	LCD_E_PULSE();
+	CLR_BIT(LCD_CTRL_PORT, LCD_u8E_PIN);
+#endif
+}
+
+#if LCD_u8BUS_MODE == LCD_u8BUS_4BIT
+/**
+ * Function: CLCD_voidWriteNibble
+ * ------------------------------
+ * Maps the nibble onto the DB4..DB7 pins (a shift when they are consecutive) and writes only those pins
+ * of the data port, then pulses E. E stays low for a pulse width afterwards, so two nibbles in a row
+ * keep the enable cycle time.
+ */
+static void CLCD_voidWriteNibble(u8 Copy_u8Nibble)
+{
+	u8 Local_u8Bits;
+
+#if LCD_NIBBLE_CONSECUTIVE
+	Local_u8Bits = (u8)((Copy_u8Nibble & 0x0Fu) << LCD_u8D4_PIN);
+#else
+	Local_u8Bits = 0u;
+	if (GET_BIT(Copy_u8Nibble, 0u) != 0u) { SET_BIT(Local_u8Bits, LCD_u8D4_PIN); }
+	if (GET_BIT(Copy_u8Nibble, 1u) != 0u) { SET_BIT(Local_u8Bits, LCD_u8D5_PIN); }
+	if (GET_BIT(Copy_u8Nibble, 2u) != 0u) { SET_BIT(Local_u8Bits, LCD_u8D6_PIN); }
+	if (GET_BIT(Copy_u8Nibble, 3u) != 0u) { SET_BIT(Local_u8Bits, LCD_u8D7_PIN); }
+#endif
+
+	LCD_DATA_PORT = (u8)((LCD_DATA_PORT & (u8)~LCD_NIBBLE_MASK) | Local_u8Bits);
+
+	SET_BIT(LCD_CTRL_PORT, LCD_u8E_PIN);
+	LCD_E_PULSE();
+	CLR_BIT(LCD_CTRL_PORT, LCD_u8E_PIN);
+	LCD_E_PULSE();
+}
+#endif
+
+/**
+ * Function: CLCD_voidWriteByte
+ * ----------------------------
+ * Blocking mode: waits for the controller, then puts the byte on the bus.
+ * Asynchronous mode: appends the byte to the queue and enables the Timer/Counter2 tick. When the queue
+ * is full, the oldest byte is sent from here first (with the tick masked), so a caller writing faster
+ * than the display, or with interrupts disabled, is slowed down instead of losing bytes.
+ */
+static void CLCD_voidWriteByte(u8 Copy_u8Byte, u8 Copy_u8Mode)
+{
+#if LCD_u8TRANSFER_MODE == LCD_u8ASYNC
+	u8 Local_u8Next = (u8)((CLCD_u8QueueHead + 1u) & LCD_QUEUE_MASK);
+
+	if (Local_u8Next == CLCD_u8QueueTail)
+	{
+		TIMER2_voidDisableInterrupt();
+		CLCD_voidSendQueued();
+	}
+
+	CLCD_au16Queue[CLCD_u8QueueHead] = LCD_QUEUE_ENTRY(Copy_u8Byte, Copy_u8Mode);
+	CLCD_u8QueueHead = Local_u8Next;
+	TIMER2_voidEnableInterrupt();
+#else
+	CLCD_voidWaitBusy();
+	CLCD_voidWriteBus(Copy_u8Byte, Copy_u8Mode);
+#endif
+}
+
+#if LCD_u8TRANSFER_MODE == LCD_u8ASYNC
+/**
+ * Function: CLCD_voidSendQueued
+ * -----------------------------
+ * Waits for the controller and sends the oldest queued byte.
+ */
+static void CLCD_voidSendQueued(void)
+{
+	u16 Local_u16Entry = CLCD_au16Queue[CLCD_u8QueueTail];
+
+	CLCD_voidWaitBusy();
+	CLCD_voidWriteBus((u8)Local_u16Entry, (u8)(Local_u16Entry >> 8));
+	CLCD_u8QueueTail = (u8)((CLCD_u8QueueTail + 1u) & LCD_QUEUE_MASK);
+}
+
+/**
+ * Function: CLCD_voidQueueTick
+ * ----------------------------
+ * Runs in the Timer/Counter2 compare match ISR. Sends the oldest queued byte if the busy flag is
+ * clear (or the display has been busy for LCD_u8BusyTicks ticks), so the queue goes out at the
+ * controller's pace, at most one byte per tick. The tick is disabled once the queue is empty, and
+ * enabled again by the next write.
+ */
+static void CLCD_voidQueueTick(void)
+{
+	u16 Local_u16Entry;
+
+	if (CLCD_u8QueueTail != CLCD_u8QueueHead)
+	{
+		if ((CLCD_u8ReadBusyFlag() == 0u) || (CLCD_u8BusyTickCount >= LCD_u8BusyTicks))
+		{
+			Local_u16Entry = CLCD_au16Queue[CLCD_u8QueueTail];
+			CLCD_voidWriteBus((u8)Local_u16Entry, (u8)(Local_u16Entry >> 8));
+			CLCD_u8QueueTail = (u8)((CLCD_u8QueueTail + 1u) & LCD_QUEUE_MASK);
+			CLCD_u8BusyTickCount = 0u;
+		}
+		else
+		{
+			CLCD_u8BusyTickCount++;
+		}
+	}
+
+	if (CLCD_u8QueueTail == CLCD_u8QueueHead)
+	{
+		TIMER2_voidDisableInterrupt();
+	}
+}
+#endif
@@ -22,7 +22,28 @@
  * This is the reference voltage used by the ADC (Analog-to-Digital Converter)
  * for converting the analog voltage to a digital value. It is assumed
  * to be 5.0 volts in this configuration.
+ *
+ * The divider is powered from the same AVCC that the ADC uses as reference, so
+ * the resistance does not depend on this value: it cancels out, and a sagging
+ * supply does not shift the light levels. The resistance tables are therefore
+ * built from R_FIXED alone.
  */
 #define VREF 5.0    // ADC reference voltage
 
+/**
+ * @brief LDR resistance at 10 lux, in ohms.
+ *
+ * Together with LDR_GAMMA it places the LDR curve R = LDR_R10 * (lux / 10) ^ -gamma used by
+ * LDR_u16GetLux. Take it from the LDR datasheet, or measure the LDR next to a lux meter.
+ */
+#define LDR_R10     10000u  // LDR resistance at 10 lux in ohms (2 .. 65535)
+
+/**
+ * @brief Slope of the LDR curve, in hundredths.
+ *
+ * This is the gamma of the LDR datasheet: the drop of log(R) per decade of lux (70 = 0.70).
+ * Valid from 13 (0.13) up; datasheet values are usually 50 to 100.
+ */
+#define LDR_GAMMA   70u     // LDR gamma in hundredths
+
 #endif //LDR_CFG_H
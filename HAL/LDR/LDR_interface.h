@@ -20,12 +20,13 @@ void LDR_VoidInit(void) ;
 /**
  * @brief Calculate the LDR resistance from an 8-bit ADC result.
  *
- * This function converts the ADC digital result from an 8-bit ADC to 
- * the corresponding voltage, then uses the voltage divider formula 
- * to calculate the LDR (Light Dependent Resistor) resistance.
+ * This function looks the ADC digital result from an 8-bit ADC up in
+ * a 256-entry flash table of the voltage divider formula,
+ * so no floating point or division runs (one flash read).
  *
  * @param Copy_u16Adc_Res: The ADC digital result (8-bit) read from the LDR.
- * @return u16: The calculated LDR resistance in ohms.
+ * @return u16: The calculated LDR resistance in ohms, 65535 when it is beyond
+ *              16 bits (including a result of 0), 0 at full scale.
  *
  * @note Assumes that the ADC resolution is 8 bits (max value = 255).
  */
@@ -34,15 +35,32 @@ u16 LDR_u16GetResistanceFrom8BitADC(u16 Copy_u16Adc_Res) ;
 /**
  * @brief Calculate the LDR resistance from a 10-bit ADC result.
  *
- * This function converts the ADC digital result from a 10-bit ADC to 
- * the corresponding voltage, then uses the voltage divider formula 
- * to calculate the LDR (Light Dependent Resistor) resistance.
+ * This function looks the ADC digital result from a 10-bit ADC up in
+ * flash tables of the voltage divider formula, interpolated
+ * between entries above a result of 64, so no floating point or division runs
+ * (about 40 cycles instead of a few thousand for the soft-float formula).
  *
  * @param Copy_u16Adc_Res: The ADC digital result (10-bit) read from the LDR.
- * @return u16: The calculated LDR resistance in ohms.
+ * @return u16: The calculated LDR resistance in ohms, 65535 when it is beyond
+ *              16 bits (including a result of 0), 0 at full scale.
  *
  * @note Assumes that the ADC resolution is 10 bits (max value = 1023).
  */
 u16 LDR_u16GetResistanceFrom10BitADC(u16 Copy_u16Adc_Res) ;
 
+/**
+ * @brief Estimate the illuminance from the LDR resistance.
+ *
+ * This function converts the LDR resistance (from one of the functions above)
+ * to lux with the LDR curve R = LDR_R10 * (lux / 10) ^ -gamma, configured by
+ * LDR_R10 and LDR_GAMMA. It works in the log domain with flash tables and
+ * integer math only, so it is cheap enough for every sample, and equal steps
+ * of log(lux) are equal steps of perceived brightness for lighting thresholds.
+ *
+ * @param Copy_u16Resistance: The LDR resistance in ohms.
+ * @return u16: The illuminance in lux (about 1% accuracy over the curve),
+ *              0 below 1 lux and 65535 beyond 16 bits.
+ */
+u16 LDR_u16GetLux(u16 Copy_u16Resistance) ;
+
 #endif //LDR_INTERFACE_H
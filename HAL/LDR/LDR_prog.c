@@ -14,6 +14,39 @@
 #include "LDR_cfg.h"
 #include "LDR_prv.h"
 
+#include <avr/pgmspace.h>
+
+/* Resistance tables in ohms, generated from R_FIXED at build time */
+static const u16 LDR_au16Table8[256] PROGMEM =
+{
+    LDR_ROW64(LDR_ENTRY8, 0u), LDR_ROW64(LDR_ENTRY8, 64u), LDR_ROW64(LDR_ENTRY8, 128u), LDR_ROW64(LDR_ENTRY8, 192u)
+};
+static const u16 LDR_au16Fine10[LDR_FINE10_SIZE] PROGMEM =
+{
+    LDR_ROW64(LDR_ENTRY10, 0u)
+};
+static const u16 LDR_au16Coarse10[LDR_COARSE10_SIZE] PROGMEM =
+{
+    LDR_ROW64(LDR_COARSE_ENTRY10, 0u), LDR_ROW64(LDR_COARSE_ENTRY10, 64u), LDR_COARSE_ENTRY10(128u)
+};
+
+/* log2(1 + i/32) in Q12 and 2^(i/32) in Q14, for i = 0 .. 32 */
+static const u16 LDR_au16Log2Table[LDR_OCTAVE_SEGMENTS + 1u] PROGMEM =
+{
+       0,  182,  358,  530,  696,  858, 1016, 1169, 1319, 1465, 1607, 1746, 1882, 2015, 2145, 2272,
+    2396, 2518, 2637, 2754, 2869, 2982, 3092, 3200, 3307, 3412, 3514, 3615, 3715, 3812, 3908, 4003,
+    4096
+};
+static const u16 LDR_au16Exp2Table[LDR_OCTAVE_SEGMENTS + 1u] PROGMEM =
+{
+    16384, 16743, 17109, 17484, 17867, 18258, 18658, 19066, 19484, 19911, 20347, 20792, 21247, 21713, 22188, 22674,
+    23170, 23678, 24196, 24726, 25268, 25821, 26386, 26964, 27554, 28158, 28774, 29405, 30048, 30706, 31379, 32066,
+    32768
+};
+
+/* log2(LDR_R10) in Q12, computed on the first conversion (0 until then, as LDR_R10 >= 2) */
+static u16 LDR_u16Log2R10 = 0u;
+
 
 /**
  * @brief Initialize the Light Dependent Resistor (LDR) system.
@@ -25,33 +58,28 @@
  */
 void LDR_VoidInit(void)
 {
+    LDR_u16Log2R10 = LDR_u16Log2(LDR_R10);
     ADC_voidInit();
 }
 
 /**
  * @brief Calculate the LDR resistance from an 8-bit ADC result.
  *
- * This function converts the ADC digital result from an 8-bit ADC to 
- * the corresponding voltage, then uses the voltage divider formula 
- * to calculate the LDR (Light Dependent Resistor) resistance.
+ * This function looks the ADC digital result up in a 256-entry flash table of the voltage divider
+ * formula, so no floating point or division runs at all (one flash read, about 15 cycles).
  *
  * @param Copy_u16Adc_Res: The ADC digital result (8-bit) read from the LDR.
- * @return u16: The calculated LDR resistance in ohms.
+ * @return u16: The calculated LDR resistance in ohms, saturated at 65535.
  *
  * @note Assumes that the ADC resolution is 8 bits (max value = 255).
  */
 u16 LDR_u16GetResistanceFrom8BitADC(u16 Copy_u16Adc_Res)
 {
-    f32 Local_f32Get_Voltage = 0;
-    u16 Local_u16Ldr_Res  = 0;
-
-    // Convert ADC digital result to voltage (assuming an 8-bit ADC, max value = 255)
-    Local_f32Get_Voltage = ((float)Copy_u16Adc_Res / 255.0) * VREF;
+    u16 Local_u16Ldr_Res = 0;
 
-    if (Local_f32Get_Voltage > 0 && Local_f32Get_Voltage < VREF)
+    if (Copy_u16Adc_Res <= 255u)
     {
-        // Use voltage divider formula to calculate LDR resistance
-        Local_u16Ldr_Res = (u16)((R_FIXED * (VREF - Local_f32Get_Voltage)) / Local_f32Get_Voltage);
+        Local_u16Ldr_Res = pgm_read_word(&LDR_au16Table8[Copy_u16Adc_Res]);
     }
 
     return Local_u16Ldr_Res;
@@ -60,29 +88,130 @@ u16 LDR_u16GetResistanceFrom8BitADC(u16 Copy_u16Adc_Res)
 /**
  * @brief Calculate the LDR resistance from a 10-bit ADC result.
  *
- * This function converts the ADC digital result from a 10-bit ADC to 
- * the corresponding voltage, then uses the voltage divider formula 
- * to calculate the LDR (Light Dependent Resistor) resistance.
+ * This function looks the ADC digital result up in flash tables of the voltage divider formula: one
+ * entry per result below 64, where the curve is steep, and a linear interpolation between entries 8
+ * counts apart above it (two flash reads, one multiply, about 40 cycles). No floating point runs.
  *
  * @param Copy_u16Adc_Res: The ADC digital result (10-bit) read from the LDR.
- * @return u16: The calculated LDR resistance in ohms.
+ * @return u16: The calculated LDR resistance in ohms, saturated at 65535.
  *
  * @note Assumes that the ADC resolution is 10 bits (max value = 1023).
  */
 u16 LDR_u16GetResistanceFrom10BitADC(u16 Copy_u16Adc_Res)
 {
-    f32 Local_f32Get_Voltage = 0;
-    u16 Local_u16Ldr_Res  = 0;
+    u16 Local_u16Ldr_Res = 0;
+    u16 Local_u16High;
+    u8 Local_u8Fraction;
 
-    // Convert ADC digital result to voltage (assuming a 10-bit ADC, max value = 1023)
-    Local_f32Get_Voltage = ((float)Copy_u16Adc_Res / 1023.0) * VREF;
-
-    // Ensure voltage is not zero to avoid division by zero
-    if (Local_f32Get_Voltage > 0 && Local_f32Get_Voltage < VREF)
+    if (Copy_u16Adc_Res < LDR_FINE10_SIZE)
+    {
+        Local_u16Ldr_Res = pgm_read_word(&LDR_au16Fine10[Copy_u16Adc_Res]);
+    }
+    else if (Copy_u16Adc_Res <= 1023u)
     {
-        // Use voltage divider formula to calculate LDR resistance
-        Local_u16Ldr_Res = (u16)((R_FIXED * (VREF - Local_f32Get_Voltage)) / Local_f32Get_Voltage);
+        // The resistance falls as the result rises: interpolate down from the entry below the result
+        Local_u16Ldr_Res = pgm_read_word(&LDR_au16Coarse10[Copy_u16Adc_Res >> LDR_COARSE10_SHIFT]);
+        Local_u16High = pgm_read_word(&LDR_au16Coarse10[(Copy_u16Adc_Res >> LDR_COARSE10_SHIFT) + 1u]);
+        Local_u8Fraction = (u8)(Copy_u16Adc_Res & (LDR_COARSE10_STEP - 1u));
+        Local_u16Ldr_Res -= (u16)((((Local_u16Ldr_Res - Local_u16High) * Local_u8Fraction) + (LDR_COARSE10_STEP / 2u)) >> LDR_COARSE10_SHIFT);
     }
 
     return Local_u16Ldr_Res;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Estimate the illuminance from the LDR resistance.
+ *
+ * This function evaluates lux = 10 * (LDR_R10 / R) ^ (1 / gamma) in the log domain: two table
+ * based logarithms, one multiply by the build-time 1 / gamma and one table based power of two.
+ * It only uses integer math (a few hundred cycles, no division), so it can run on every sample.
+ *
+ * @param Copy_u16Resistance: The LDR resistance in ohms.
+ * @return u16: The illuminance in lux, saturated at 65535 (a resistance of 0 reads as 65535).
+ */
+u16 LDR_u16GetLux(u16 Copy_u16Resistance)
+{
+    u16 Local_u16Lux = LDR_MAX_LUX;
+    s32 Local_s32Log;
+
+    if (LDR_u16Log2R10 == 0u)
+    {
+        LDR_u16Log2R10 = LDR_u16Log2(LDR_R10);
+    }
+
+    if (Copy_u16Resistance != 0u)
+    {
+        // log2(lux) in Q24
+        Local_s32Log = LDR_LOG2_10_Q24 + (((s32)LDR_u16Log2R10 - (s32)LDR_u16Log2(Copy_u16Resistance)) * (s32)LDR_GAMMA_RECIP_Q12);
+
+        if (Local_s32Log < 0)
+        {
+            // Below 1 lux
+            Local_u16Lux = 0u;
+        }
+        else
+        {
+            Local_s32Log = (Local_s32Log + (1L << (LDR_LOG_SHIFT - 1u))) >> LDR_LOG_SHIFT;
+            if ((u32)Local_s32Log < LDR_LOG_LIMIT_Q12)
+            {
+                Local_u16Lux = LDR_u16Exp2((u16)Local_s32Log);
+            }
+        }
+    }
+
+    return Local_u16Lux;
+}
+
+/**
+ * Function: LDR_u16Log2
+ * ---------------------
+ * Normalises the value so that its leading one is in bit 15: the shift count gives the integer
+ * part, and the 15 bits below the leading one give the fraction, through the log2 table segment
+ * picked by their top 5 bits and a linear interpolation on the next 8. The interpolation truncates,
+ * which keeps log2(65535) below 16 in Q12.
+ */
+static u16 LDR_u16Log2(u16 Copy_u16Value)
+{
+    u8 Local_u8Exponent = 15u;
+    u8 Local_u8Index;
+    u8 Local_u8Fraction;
+    u16 Local_u16Low;
+
+    while ((Copy_u16Value & 0x8000u) == 0u)
+    {
+        Copy_u16Value <<= 1;
+        Local_u8Exponent--;
+    }
+
+    Local_u8Index = (u8)((Copy_u16Value >> 10) & (LDR_OCTAVE_SEGMENTS - 1u));
+    Local_u8Fraction = (u8)(Copy_u16Value >> 2);
+    Local_u16Low = pgm_read_word(&LDR_au16Log2Table[Local_u8Index]);
+    Local_u16Low += (u16)(((u16)(pgm_read_word(&LDR_au16Log2Table[Local_u8Index + 1u]) - Local_u16Low) * Local_u8Fraction) >> 8);
+
+    return (u16)(((u16)Local_u8Exponent << LDR_LOG_SHIFT) + Local_u16Low);
+}
+
+/**
+ * Function: LDR_u16Exp2
+ * ---------------------
+ * Interpolates the Q14 mantissa of the fractional part in the exp2 table (segment from the top 5
+ * fraction bits, position from the other 7), then shifts it by the integer part and rounds it.
+ */
+static u16 LDR_u16Exp2(u16 Copy_u16Log)
+{
+    u8 Local_u8Index = (u8)((Copy_u16Log >> 7) & (LDR_OCTAVE_SEGMENTS - 1u));
+    u8 Local_u8Fraction = (u8)(Copy_u16Log & 0x7Fu);
+    u16 Local_u16Mantissa;
+    u32 Local_u32Result;
+
+    Local_u16Mantissa = pgm_read_word(&LDR_au16Exp2Table[Local_u8Index]);
+    Local_u16Mantissa += (u16)((((u32)(pgm_read_word(&LDR_au16Exp2Table[Local_u8Index + 1u]) - Local_u16Mantissa) * Local_u8Fraction) + 64UL) >> 7);
+
+    Local_u32Result = (((u32)Local_u16Mantissa << (Copy_u16Log >> LDR_LOG_SHIFT)) + (1UL << (LDR_EXP_MANTISSA_SHIFT - 1u))) >> LDR_EXP_MANTISSA_SHIFT;
+    if (Local_u32Result > LDR_MAX_LUX)
+    {
+        Local_u32Result = LDR_MAX_LUX;
+    }
+
+    return (u16)Local_u32Result;
+}
@@ -7,8 +7,84 @@
 #ifndef LDR_PRV_H
 #define LDR_PRV_H
 
+/**
+ * @brief Macros generating the resistance tables at build time.
+ *
+ * The LDR is the upper leg of the divider and R_FIXED the lower one, both fed from the ADC reference, so
+ * a result D out of a full scale FS gives R = R_FIXED * (FS - D) / D, whatever the reference voltage is.
+ * LDR_RESISTANCE rounds it to nearest and saturates it to 16 bits; D = 0 (no current, darker than the
+ * range) reads as LDR_MAX_RESISTANCE and D = FS as 0. The divisor is never 0, even in the branch that
+ * is not taken.
+ */
+#define LDR_MAX_RESISTANCE      0xFFFFu
 
+#define LDR_RESISTANCE_RAW(D, FS)   ((((u32)R_FIXED * ((u32)(FS) - (u32)(D))) + ((u32)(D) / 2UL)) / ((u32)(D) + ((D) == 0u)))
+#define LDR_RESISTANCE(D, FS)       ((u16)(((D) == 0u) ? LDR_MAX_RESISTANCE : \
+                                           (((D) >= (FS)) ? 0u : \
+                                           ((LDR_RESISTANCE_RAW((D), (FS)) > LDR_MAX_RESISTANCE) ? LDR_MAX_RESISTANCE : \
+                                            LDR_RESISTANCE_RAW((D), (FS))))))
 
+#define LDR_ROW8(F, B)      F((B)), F((B) + 1u), F((B) + 2u), F((B) + 3u), F((B) + 4u), F((B) + 5u), F((B) + 6u), F((B) + 7u)
+#define LDR_ROW64(F, B)     LDR_ROW8(F, (B)), LDR_ROW8(F, (B) + 8u), LDR_ROW8(F, (B) + 16u), LDR_ROW8(F, (B) + 24u), \
+                            LDR_ROW8(F, (B) + 32u), LDR_ROW8(F, (B) + 40u), LDR_ROW8(F, (B) + 48u), LDR_ROW8(F, (B) + 56u)
+
+/**
+ * @brief Layout of the 10-bit tables.
+ *
+ * The resistance is a hyperbola, steep at low results, so the results below LDR_FINE10_SIZE have an
+ * entry each, and the others are interpolated between entries LDR_COARSE10_STEP counts apart (error
+ * below 0.5%).
+ */
+#define LDR_FINE10_SIZE         64u
+#define LDR_COARSE10_SHIFT      3u
+#define LDR_COARSE10_STEP       (1u << LDR_COARSE10_SHIFT)
+#define LDR_COARSE10_SIZE       129u    /* 0 .. 1024 */
+
+#define LDR_ENTRY8(I)           LDR_RESISTANCE((I), 255u)
+#define LDR_ENTRY10(I)          LDR_RESISTANCE((I), 1023u)
+#define LDR_COARSE_ENTRY10(I)   LDR_RESISTANCE((u32)(I) << LDR_COARSE10_SHIFT, 1023u)
+
+#if (LDR_R10 < 2u) || (LDR_R10 > 65535u)
+#error "LDR_R10 must be between 2 and 65535 ohms"
+#endif
+
+/* Below 13, 16 octaves of log2 difference times LDR_GAMMA_RECIP_Q12 no longer fit the s32 log2(lux) in Q24 */
+#if (LDR_GAMMA < 13u)
+#error "LDR_GAMMA must be at least 13 (0.13)"
+#endif
+
+/**
+ * @brief Fixed-point formats of the lux conversion.
+ *
+ * The lux is computed in the log domain: log2(lux) = log2(10) + (log2(LDR_R10) - log2(R)) / gamma.
+ * Logarithms are Q12 (4096 = 1), 1 / gamma is a Q12 constant computed at build time, and their
+ * product is Q24 before it is rounded back to Q12 for the power of two.
+ */
+#define LDR_LOG_SHIFT           12u
+#define LDR_LOG2_10_Q24         55732705L   /* log2(10) = 3.3219 */
+#define LDR_GAMMA_RECIP_Q12     ((((u32)100u << LDR_LOG_SHIFT) + (LDR_GAMMA / 2u)) / LDR_GAMMA)
+#define LDR_LOG_LIMIT_Q12       (16UL << LDR_LOG_SHIFT)     /* 2^16 lux, beyond 16 bits */
+
+/* The log2 and exp2 tables have 32 segments over one octave; the exp2 mantissa is Q14 */
+#define LDR_OCTAVE_SEGMENTS     32u
+#define LDR_EXP_MANTISSA_SHIFT  14u
+#define LDR_MAX_LUX             0xFFFFu
+
+/**
+ * @brief Calculate log2 of a non-zero value in Q12.
+ *
+ * @param Copy_u16Value: The value, must not be 0.
+ * @return u16: log2 of the value in Q12.
+ */
+static u16 LDR_u16Log2(u16 Copy_u16Value);
+
+/**
+ * @brief Calculate 2 to the power of a Q12 value below 16, rounded to an integer.
+ *
+ * @param Copy_u16Log: The power in Q12.
+ * @return u16: 2 to the power of the value, saturated at 65535.
+ */
+static u16 LDR_u16Exp2(u16 Copy_u16Log);
 
 
 #endif //LDR_PRV_H
@@ -22,7 +22,7 @@
  */
 typedef struct
 {
-    u8 Vref;         /**< Reference voltage for the ADC. */
+    u16 Vref;        /**< Reference voltage for the ADC, in millivolts. */
     u8 resolution;   /**< Resolution of the ADC in bits (e.g., 8-bit, 10-bit). */
 } ADC_info;
 
@@ -33,20 +33,56 @@ typedef struct
  */
 #define RES_EIGHT_BITS              8   /**< 8-bit ADC resolution. */
 #define RES_TEN_BITS                10  /**< 10-bit ADC resolution. */
+#define RES_TWELVE_BITS             12  /**< 12-bit result (10-bit ADC oversampled 16 times). */
 
 /**
  * @brief ADC Reference Voltage Options
  * 
  * The following defines represent the possible reference voltages for the ADC.
  */
-#define Vref_AVCC                   5   /**< Reference voltage of 5V (AVCC). */
-#define Vref_INTERNAL               2.56/**< Internal reference voltage of 2.56V. */
+#define Vref_AVCC                   5000    /**< Reference voltage of 5V (AVCC), in millivolts. */
+#define Vref_INTERNAL               2560    /**< Internal reference voltage of 2.56V, in millivolts. */
+
+/**
+ * @brief Get the temperature from an LM35 reading, in tenths of a degree.
+ * 
+ * The LM35 gives 10 mV per degree, so the result is the input voltage in millivolts. For Vref_AVCC and
+ * Vref_INTERNAL it comes from tables generated at build time and kept in flash:
+ * - 8-bit results: a 256-entry table, one flash read.
+ * - 10-bit and 12-bit results up to twice the full scale (auto-ranged scan results included): a
+ *   129-entry coarse table, interpolated with one 8x8 multiply, within 1 tenth of the exact value.
+ * Other reference voltages and readings outside the tables use the 32-bit arithmetic.
+ * 
+ * Cost per reading on the ATmega32, hand-counted from the C code at -Os; these are estimates, not
+ * measurements (the -O0 Debug build is a few times slower for all three):
+ * - 32-bit multiply and divide (the previous conversion, and the fallback): about 650 cycles (40 us at 16 MHz).
+ * - 8-bit table lookup: about 15 cycles.
+ * - 10/12-bit interpolation: about 50 cycles.
+ * To measure them on the target, build with MEASURE_LM35_CYCLES set in main.c: the three averages,
+ * timed with Timer/Counter1, are shown on the LCD at start-up.
+ * The tables take 2 KB of flash and no RAM.
+ * 
+ * @param[in] Copy_component Pointer to an `ADC_info` structure containing ADC configuration details.
+ * @param[in] Dig_Temp The raw ADC value read from the LM35 sensor.
+ * @param[out] Result Pointer to a `u16` variable where the temperature, in tenths of a degree, will be stored.
+ * 
+ * @return `u8` Error status code:
+ *         - `NO_ERROR` if the operation is successful.
+ *         - `ERROR` if the resolution in `Copy_component` is not 8, 10 or 12 bits.
+ *         - `NULL_PTR_ERR` if a pointer is NULL.
+ */
+u8 LM35_u8GetTemperatureTenths(ADC_info* Copy_component , u16 Dig_Temp , u16* Result);
 
 /**
  * @brief Get the temperature reading from an LM35 temperature sensor.
  * 
  * This function converts the raw ADC value from the LM35 sensor to a temperature value based on
- * the sensor's resolution and reference voltage.
+ * the sensor's resolution and reference voltage. The LM35 gives 10 mV per degree, so the
+ * temperature is Dig_Temp * Vref / (full scale * 10). It is LM35_u8GetTemperatureTenths without the
+ * tenths.
+ * 
+ * An auto-ranged ADC scan result is in internal reference counts, so it is converted with
+ * Vref_INTERNAL; it may then be larger than the full scale of the resolution.
  * 
  * @param[in] Copy_component Pointer to an `ADC_info` structure containing ADC configuration details.
  * @param[in] Dig_Temp The raw ADC value read from the LM35 sensor.
@@ -54,8 +90,8 @@ typedef struct
  * 
  * @return `u8` Error status code:
  *         - `NO_ERROR` if the operation is successful.
- *         - `ERROR` if the resolution in `Copy_component` is neither 8 nor 10 bits.
- *         - `NULL_PTR_ERR` if the `Copy_component` pointer is NULL.
+ *         - `ERROR` if the resolution in `Copy_component` is not 8, 10 or 12 bits.
+ *         - `NULL_PTR_ERR` if a pointer is NULL.
  */
 u8 LM35_getTemperature(ADC_info* Copy_component , u16 Dig_Temp , u16* Result);
 
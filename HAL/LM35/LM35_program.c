@@ -8,56 +8,212 @@
  *********************************************/
 
 #include "STD_types.h"
-#include "map.h"
 
 #include "LM35_interface.h"
 
 #include "ADC_interface.h"
 
+#include <avr/pgmspace.h>
+
+/*
+ * Conversion tables, generated by the preprocessor at build time from Vref_AVCC and Vref_INTERNAL.
+ * The LM35 gives 10 mV per degree, so a temperature in tenths of a degree is the input in millivolts:
+ * Dig_Temp * Vref / full scale, rounded to nearest.
+ *  - 8-bit: one entry per result (256 entries).
+ *  - 10-bit and 12-bit: a coarse table with LM35_COARSE_INTERVALS intervals over twice the full scale (one
+ *    entry every 16 or 64 counts), interpolated linearly. Twice the full scale covers the auto-ranged
+ *    scan results, which go above the full scale of the resolution.
+ */
+#define LM35_TENTHS(D, VREF, FULL)  ((u16)((((u32)(D) * (u32)(VREF)) + ((u32)(FULL) / 2UL)) / (u32)(FULL)))
+
+#define LM35_COARSE_INTERVALS       128u
+#define LM35_COARSE10_SHIFT         4u  /* 2048 / 128 counts per interval */
+#define LM35_COARSE12_SHIFT         6u  /* 8192 / 128 counts per interval */
+
+#define LM35_ROW8(F, B)     F((B)), F((B) + 1u), F((B) + 2u), F((B) + 3u), F((B) + 4u), F((B) + 5u), F((B) + 6u), F((B) + 7u)
+#define LM35_ROW64(F, B)    LM35_ROW8(F, (B)), LM35_ROW8(F, (B) + 8u), LM35_ROW8(F, (B) + 16u), LM35_ROW8(F, (B) + 24u), \
+                            LM35_ROW8(F, (B) + 32u), LM35_ROW8(F, (B) + 40u), LM35_ROW8(F, (B) + 48u), LM35_ROW8(F, (B) + 56u)
+
+#define LM35_FINE_AVCC(I)       LM35_TENTHS((I), Vref_AVCC, 255u)
+#define LM35_FINE_INTERNAL(I)   LM35_TENTHS((I), Vref_INTERNAL, 255u)
+#define LM35_COARSE10_AVCC(I)       LM35_TENTHS((u32)(I) << LM35_COARSE10_SHIFT, Vref_AVCC, 1023u)
+#define LM35_COARSE10_INTERNAL(I)   LM35_TENTHS((u32)(I) << LM35_COARSE10_SHIFT, Vref_INTERNAL, 1023u)
+#define LM35_COARSE12_AVCC(I)       LM35_TENTHS((u32)(I) << LM35_COARSE12_SHIFT, Vref_AVCC, 4095u)
+#define LM35_COARSE12_INTERNAL(I)   LM35_TENTHS((u32)(I) << LM35_COARSE12_SHIFT, Vref_INTERNAL, 4095u)
+
+/* 8-bit results, in tenths of a degree */
+static const u16 LM35_au16FineAvcc[256] PROGMEM =
+{
+    LM35_ROW64(LM35_FINE_AVCC, 0u), LM35_ROW64(LM35_FINE_AVCC, 64u),
+    LM35_ROW64(LM35_FINE_AVCC, 128u), LM35_ROW64(LM35_FINE_AVCC, 192u)
+};
+static const u16 LM35_au16FineInternal[256] PROGMEM =
+{
+    LM35_ROW64(LM35_FINE_INTERNAL, 0u), LM35_ROW64(LM35_FINE_INTERNAL, 64u),
+    LM35_ROW64(LM35_FINE_INTERNAL, 128u), LM35_ROW64(LM35_FINE_INTERNAL, 192u)
+};
+
+/* 10-bit results every 16 counts, in tenths of a degree */
+static const u16 LM35_au16Coarse10Avcc[LM35_COARSE_INTERVALS + 1u] PROGMEM =
+{
+    LM35_ROW64(LM35_COARSE10_AVCC, 0u), LM35_ROW64(LM35_COARSE10_AVCC, 64u), LM35_COARSE10_AVCC(128u)
+};
+static const u16 LM35_au16Coarse10Internal[LM35_COARSE_INTERVALS + 1u] PROGMEM =
+{
+    LM35_ROW64(LM35_COARSE10_INTERNAL, 0u), LM35_ROW64(LM35_COARSE10_INTERNAL, 64u), LM35_COARSE10_INTERNAL(128u)
+};
+
+/* 12-bit results every 64 counts, in tenths of a degree */
+static const u16 LM35_au16Coarse12Avcc[LM35_COARSE_INTERVALS + 1u] PROGMEM =
+{
+    LM35_ROW64(LM35_COARSE12_AVCC, 0u), LM35_ROW64(LM35_COARSE12_AVCC, 64u), LM35_COARSE12_AVCC(128u)
+};
+static const u16 LM35_au16Coarse12Internal[LM35_COARSE_INTERVALS + 1u] PROGMEM =
+{
+    LM35_ROW64(LM35_COARSE12_INTERNAL, 0u), LM35_ROW64(LM35_COARSE12_INTERNAL, 64u), LM35_COARSE12_INTERNAL(128u)
+};
+
 /**
- * @brief Get the temperature reading from an LM35 temperature sensor.
+ * @brief Get the temperature from an LM35 reading, in tenths of a degree.
  * 
- * This function converts the raw ADC value from the LM35 sensor to a temperature value based on
- * the sensor's resolution and reference voltage.
+ * The reading is looked up in the tables for Vref_AVCC and Vref_INTERNAL:
+ *  - 8-bit results up to 255: one flash read.
+ *  - 10-bit and 12-bit results up to twice the full scale: two flash reads of the coarse table, an
+ *    8x8 multiply and a shift to interpolate, within 1 tenth of the exact value.
+ * Any other reference voltage, or a reading beyond the tables (like an auto-ranged 8-bit result above
+ * 255), uses Dig_Temp * Vref / full scale in 32 bits.
  * 
  * @param[in] Copy_component Pointer to an `ADC_info` structure containing ADC configuration details.
  * @param[in] Dig_Temp The raw ADC value read from the LM35 sensor.
- * @param[out] Result Pointer to a `u16` variable where the calculated temperature value will be stored.
+ * @param[out] Result Pointer to a `u16` variable where the temperature, in tenths of a degree, will be stored.
  * 
  * @return `u8` Error status code:
  *         - `NO_ERROR` if the operation is successful.
- *         - `ERROR` if the resolution in `Copy_component` is neither 8 nor 10 bits.
- *         - `NULL_PTR_ERR` if the `Copy_component` pointer is NULL.
+ *         - `ERROR` if the resolution in `Copy_component` is not 8, 10 or 12 bits.
+ *         - `NULL_PTR_ERR` if a pointer is NULL.
  */
-u8 LM35_getTemperature(ADC_info* Copy_component, u16 Dig_Temp, u16* Result)
+u8 LM35_u8GetTemperatureTenths(ADC_info* Copy_component, u16 Dig_Temp, u16* Result)
 {
     u8 Local_u8ErrState = NO_ERROR;
-    
-    if (Copy_component != NULL)
+    u8 Local_u8Shift = 0u;
+    u16 Local_u16FullScale = 0u;
+    u16 Local_u16Low;
+    u8 Local_u8Step;
+    u8 Local_u8Fraction;
+    const u16* Local_pu16Fine = NULL;
+    const u16* Local_pu16Coarse = NULL;
+
+    if ((Copy_component != NULL) && (Result != NULL))
     {
         if (Copy_component->resolution == 8)
         {
-            // Convert 8-bit ADC value to temperature
-            Dig_Temp = (u16) Map(0, 5, 0, Copy_component->Vref, Dig_Temp);
-            *Result = (u16)(((u32)Dig_Temp * ((u32)(Copy_component->Vref) * 100UL)) / 255UL);
+            Local_u16FullScale = 255u;
         }
         else if (Copy_component->resolution == 10)
         {
-            // Convert 10-bit ADC value to temperature
-            Dig_Temp = (u16) Map(0, 1023, 0, 255, Dig_Temp);
-            *Result = (u16)(((u32)Dig_Temp * ((u32)(Copy_component->Vref) * 100UL)) / 1023UL);
+            Local_u8Shift = LM35_COARSE10_SHIFT;
+            Local_u16FullScale = 1023u;
+        }
+        else if (Copy_component->resolution == 12)
+        {
+            Local_u8Shift = LM35_COARSE12_SHIFT;
+            Local_u16FullScale = 4095u;
         }
         else
         {
             // Invalid resolution
             Local_u8ErrState = ERROR;
         }
+
+        if (Copy_component->Vref == Vref_AVCC)
+        {
+            Local_pu16Fine = LM35_au16FineAvcc;
+            if (Local_u8Shift == LM35_COARSE10_SHIFT)
+            {
+                Local_pu16Coarse = LM35_au16Coarse10Avcc;
+            }
+            else if (Local_u8Shift == LM35_COARSE12_SHIFT)
+            {
+                Local_pu16Coarse = LM35_au16Coarse12Avcc;
+            }
+        }
+        else if (Copy_component->Vref == Vref_INTERNAL)
+        {
+            Local_pu16Fine = LM35_au16FineInternal;
+            if (Local_u8Shift == LM35_COARSE10_SHIFT)
+            {
+                Local_pu16Coarse = LM35_au16Coarse10Internal;
+            }
+            else if (Local_u8Shift == LM35_COARSE12_SHIFT)
+            {
+                Local_pu16Coarse = LM35_au16Coarse12Internal;
+            }
+        }
+
+        if (Local_u8ErrState != NO_ERROR)
+        {
+            // Error already set
+        }
+        else if ((Local_pu16Fine != NULL) && (Copy_component->resolution == 8) && (Dig_Temp <= 255u))
+        {
+            // 8-bit result: direct lookup
+            *Result = pgm_read_word(&Local_pu16Fine[Dig_Temp]);
+        }
+        else if ((Local_pu16Coarse != NULL) && ((Dig_Temp >> Local_u8Shift) < LM35_COARSE_INTERVALS))
+        {
+            // Interpolate between the two coarse entries around the result, rounding to nearest
+            Local_u16Low = pgm_read_word(&Local_pu16Coarse[Dig_Temp >> Local_u8Shift]);
+            Local_u8Step = (u8)(pgm_read_word(&Local_pu16Coarse[(Dig_Temp >> Local_u8Shift) + 1u]) - Local_u16Low);
+            Local_u8Fraction = (u8)(Dig_Temp & ((1u << Local_u8Shift) - 1u));
+            *Result = Local_u16Low + (u16)((((u16)Local_u8Step * Local_u8Fraction) + (1u << (Local_u8Shift - 1u))) >> Local_u8Shift);
+        }
+        else
+        {
+            // No table for this reference, or beyond it
+            *Result = (u16)(((u32)Dig_Temp * (u32)(Copy_component->Vref)) / (u32)Local_u16FullScale);
+        }
     }
     else
     {
         // Null pointer error
         Local_u8ErrState = NULL_PTR_ERR;
     }
-    
+
+    return Local_u8ErrState;
+}
+
+
+/**
+ * @brief Get the temperature reading from an LM35 temperature sensor.
+ * 
+ * This function converts the raw ADC value from the LM35 sensor to a temperature value based on
+ * the sensor's resolution and reference voltage, through LM35_u8GetTemperatureTenths, and drops
+ * the tenths.
+ * 
+ * @param[in] Copy_component Pointer to an `ADC_info` structure containing ADC configuration details.
+ * @param[in] Dig_Temp The raw ADC value read from the LM35 sensor.
+ * @param[out] Result Pointer to a `u16` variable where the calculated temperature value will be stored.
+ * 
+ * @return `u8` Error status code:
+ *         - `NO_ERROR` if the operation is successful.
+ *         - `ERROR` if the resolution in `Copy_component` is not 8, 10 or 12 bits.
+ *         - `NULL_PTR_ERR` if a pointer is NULL.
+ */
+u8 LM35_getTemperature(ADC_info* Copy_component, u16 Dig_Temp, u16* Result)
+{
+    u8 Local_u8ErrState;
+    u16 Local_u16Tenths;
+
+    Local_u8ErrState = LM35_u8GetTemperatureTenths(Copy_component, Dig_Temp, &Local_u16Tenths);
+    if ((Local_u8ErrState == NO_ERROR) && (Result != NULL))
+    {
+        *Result = Local_u16Tenths / 10u;
+    }
+    else if (Local_u8ErrState == NO_ERROR)
+    {
+        // Null pointer error
+        Local_u8ErrState = NULL_PTR_ERR;
+    }
+
     return Local_u8ErrState;
-}
\ No newline at end of file
+}
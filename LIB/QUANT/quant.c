@@ -0,0 +1,122 @@
+/****************************************
+*            Author  : ENG.Yosef Zaher  *                         
+*            Date    : 17/10/2026       *                      
+*            Version : 1.0.0            *                     
+*****************************************/
+
+#include "STD_TYPES.h"
+
+#include "quant.h"
+
+#include <avr/pgmspace.h>
+
+
+/**
+ * @brief Initializes a quantiser.
+ *
+ * @param Copy_pQuant        The quantiser to initialize.
+ * @param Copy_pBoundaries   The boundary table in flash, sorted by ascending threshold.
+ * @param Copy_u8Count       The number of boundaries (at most 254).
+ *
+ * @return NO_ERROR, NULL_PTR_ERR, or ERROR for an empty or too long table.
+ */
+u8 QUANT_u8Init(QUANT_t *Copy_pQuant, const QUANT_Boundary_t *Copy_pBoundaries, u8 Copy_u8Count)
+{
+    u8 Local_u8ErrorState = NO_ERROR;
+
+    if ((Copy_pQuant == NULL) || (Copy_pBoundaries == NULL))
+    {
+        Local_u8ErrorState = NULL_PTR_ERR;
+    }
+    else if ((Copy_u8Count == 0u) || (Copy_u8Count >= QUANT_NO_LEVEL))
+    {
+        Local_u8ErrorState = ERROR;
+    }
+    else
+    {
+        Copy_pQuant->Boundaries = Copy_pBoundaries;
+        Copy_pQuant->Count = Copy_u8Count;
+        Copy_pQuant->Level = QUANT_NO_LEVEL;
+    }
+
+    return Local_u8ErrorState;
+}
+
+/**
+ * @brief Quantises a reading and reports the level when it changes.
+ *
+ * @param Copy_pQuant    The quantiser.
+ * @param Copy_u16Value  The reading.
+ *
+ * @return The new level when it changed (always on the first update), QUANT_NO_CHANGE otherwise
+ *         or when the quantiser is NULL.
+ */
+u8 QUANT_u8Update(QUANT_t *Copy_pQuant, u16 Copy_u16Value)
+{
+    u8 Local_u8Changed = QUANT_NO_CHANGE;
+    u8 Local_u8Level;
+    u8 Local_u8Stay = 1u;
+    u8 Local_u8Low;
+    u8 Local_u8High;
+    u8 Local_u8Middle;
+    const QUANT_Boundary_t *Local_pBoundary;
+
+    if (Copy_pQuant != NULL)
+    {
+        Local_u8Level = Copy_pQuant->Level;
+
+        if (Local_u8Level == QUANT_NO_LEVEL)
+        {
+            Local_u8Stay = 0u;
+        }
+        else
+        {
+            // Leave downwards only Hysteresis below the lower boundary of the level
+            if (Local_u8Level > 0u)
+            {
+                Local_pBoundary = &Copy_pQuant->Boundaries[Local_u8Level - 1u];
+                if (((u32)Copy_u16Value + pgm_read_word(&Local_pBoundary->Hysteresis)) < pgm_read_word(&Local_pBoundary->Threshold))
+                {
+                    Local_u8Stay = 0u;
+                }
+            }
+
+            // Leave upwards only Hysteresis above the upper boundary of the level
+            if (Local_u8Level < Copy_pQuant->Count)
+            {
+                Local_pBoundary = &Copy_pQuant->Boundaries[Local_u8Level];
+                if ((u32)Copy_u16Value >= ((u32)pgm_read_word(&Local_pBoundary->Threshold) + pgm_read_word(&Local_pBoundary->Hysteresis)))
+                {
+                    Local_u8Stay = 0u;
+                }
+            }
+        }
+
+        if (Local_u8Stay == 0u)
+        {
+            // The level is the number of thresholds at or below the reading
+            Local_u8Low = 0u;
+            Local_u8High = Copy_pQuant->Count;
+            while (Local_u8Low < Local_u8High)
+            {
+                Local_u8Middle = (u8)((Local_u8Low + Local_u8High) >> 1);
+                if (pgm_read_word(&Copy_pQuant->Boundaries[Local_u8Middle].Threshold) <= Copy_u16Value)
+                {
+                    Local_u8Low = Local_u8Middle + 1u;
+                }
+                else
+                {
+                    Local_u8High = Local_u8Middle;
+                }
+            }
+
+            if (Local_u8Low != Local_u8Level)
+            {
+                Copy_pQuant->Level = Local_u8Low;
+                Local_u8Changed = Local_u8Low;
+            }
+        }
+    }
+
+    return Local_u8Changed;
+}
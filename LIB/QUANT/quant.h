@@ -0,0 +1,79 @@
+/****************************************
+*            Author  : ENG.Yosef Zaher  *                         
+*            Date    : 17/10/2026       *                      
+*            Version : 1.0.0            *                     
+*****************************************/
+
+/**
+ * @file quant.h
+ * @brief Quantiser turning a reading into a level index with hysteresis.
+ */
+
+
+#ifndef QUANT_H
+#define QUANT_H
+
+
+/**
+ * @brief Value returned by QUANT_u8Update when the level did not change.
+ */
+#define QUANT_NO_CHANGE     0xFFu
+
+/**
+ * @brief Level of a quantiser that has not been updated yet.
+ */
+#define QUANT_NO_LEVEL      0xFFu
+
+/**
+ * @brief Boundary between two levels.
+ *
+ * A reading below Threshold is under the boundary, and from Threshold up it is above it. Once a
+ * level is reached, the reading has to go Hysteresis past a boundary of the level to leave it.
+ */
+typedef struct
+{
+    u16 Threshold;      /**< Lowest reading above the boundary. */
+    u16 Hysteresis;     /**< Distance past the boundary needed to cross it from the other side. */
+} QUANT_Boundary_t;
+
+/**
+ * @brief Quantiser state.
+ *
+ * With Count boundaries sorted by ascending threshold, the levels go from 0 (below the first
+ * boundary) to Count (above the last one).
+ */
+typedef struct
+{
+    const QUANT_Boundary_t *Boundaries;     /**< Boundary table, in flash (PROGMEM). */
+    u8 Count;                               /**< Number of boundaries in the table. */
+    u8 Level;                               /**< Current level, QUANT_NO_LEVEL before the first update. */
+} QUANT_t;
+
+
+/**
+ * @brief Initializes a quantiser.
+ *
+ * @param Copy_pQuant        The quantiser to initialize.
+ * @param Copy_pBoundaries   The boundary table in flash, sorted by ascending threshold.
+ * @param Copy_u8Count       The number of boundaries (at most 254).
+ *
+ * @return NO_ERROR, NULL_PTR_ERR, or ERROR for an empty or too long table.
+ */
+u8 QUANT_u8Init(QUANT_t *Copy_pQuant, const QUANT_Boundary_t *Copy_pBoundaries, u8 Copy_u8Count);
+
+/**
+ * @brief Quantises a reading and reports the level when it changes.
+ *
+ * While the reading stays within the current level, widened by the hysteresis of its two
+ * boundaries, this costs two comparisons. Otherwise the new level is found by a binary search
+ * of the boundary table.
+ *
+ * @param Copy_pQuant    The quantiser.
+ * @param Copy_u16Value  The reading.
+ *
+ * @return The new level when it changed (always on the first update), QUANT_NO_CHANGE otherwise
+ *         or when the quantiser is NULL.
+ */
+u8 QUANT_u8Update(QUANT_t *Copy_pQuant, u16 Copy_u16Value);
+
+#endif
@@ -0,0 +1,41 @@
+/*******************************************************************/
+/***************     Author: Youssef_Farid		   *****************/
+/***************     Layer: MCAL                   *****************/
+/***************     ACOMP_config                  *****************/
+/*******************************************************************/
+
+#ifndef ACOMP_CONFIG_H
+#define ACOMP_CONFIG_H
+
+/**
+ * @brief Macro for selecting the positive input of the comparator.
+ *
+ * Options:
+ *  - ACOMP_AIN0: The AIN0 pin (PB2).
+ *  - ACOMP_BANDGAP: The internal bandgap reference, which leaves PB2 free (it is the INT2 button).
+ *
+ * The negative input is always the AIN1 pin (PB3). The ADC multiplexer could drive it instead, but only
+ * while the ADC is disabled, and the ADC scan keeps it running.
+ */
+#define ACOMP_u8PositiveInput                ACOMP_BANDGAP  /**< Positive input option */
+
+/**
+ * @brief Macro for selecting the edge of the comparator output that raises the interrupt.
+ *
+ * Options:
+ *  - ACOMP_TOGGLE: Any output change.
+ *  - ACOMP_FALLING: AIN1 rising above the positive input.
+ *  - ACOMP_RISING: AIN1 falling below the positive input.
+ */
+#define ACOMP_u8InterruptMode                ACOMP_RISING  /**< Interrupt mode option */
+
+/**
+ * @brief Macro to define how long the bandgap reference is given to settle before the interrupt
+ * is enabled, in microseconds.
+ *
+ * The datasheet gives a start-up time of up to 70 us; enabling the interrupt earlier could raise a
+ * false edge.
+ */
+#define ACOMP_u8BandgapSettleTime            70u  /**< Bandgap settle time (in microseconds) */
+
+#endif
@@ -0,0 +1,47 @@
+/*******************************************************************/
+/***************     Author: Youssef_Farid		   *****************/
+/***************     Layer: MCAL                   *****************/
+/***************     ACOMP_interface               *****************/
+/*******************************************************************/
+
+#ifndef ACOMP_INTERFACE_H
+#define ACOMP_INTERFACE_H
+
+/**
+ * @brief Initialize the analog comparator.
+ *
+ * This function powers the comparator, selects the positive input and the interrupt edge from
+ * ACOMP_config.h and enables the comparator interrupt. The negative input is the AIN1 pin (PB3),
+ * which must be configured as an input without pull-up.
+ *
+ * With ACOMP_RISING (or ACOMP_FALLING), the output may already be high (or low) when the function
+ * is called, at boot or when re-arming, and then no edge would ever be reported. In that case the
+ * callback is called once from ACOMP_voidInit itself, so set it before calling this function.
+ *
+ * The comparator works without the CPU: an input crossing sets its flag within a few hundred
+ * nanoseconds and the interrupt runs as soon as global interrupts allow it, whatever the main loop
+ * is doing.
+ */
+void ACOMP_voidInit(void);
+
+/**
+ * @brief Read the comparator output.
+ *
+ * @param Copy_pu8Output: Pointer to store the output: 1 if the positive input is above AIN1, 0 otherwise.
+ * @return u8: Status of the operation:
+ * - '0u' on success,
+ * - '2u' if the output pointer is NULL.
+ */
+u8 ACOMP_u8GetOutput(u8* Copy_pu8Output);
+
+/**
+ * @brief Set the callback function for the analog comparator interrupt.
+ *
+ * @param Copy_pvCallBackFunc: Pointer to the function called from the comparator ISR.
+ * @return u8: Status of the operation:
+ * - '0u' on success,
+ * - '2u' if the callback pointer is NULL.
+ */
+u8 ACOMP_u8SetCallBack(void(*Copy_pvCallBackFunc)(void));
+
+#endif
@@ -0,0 +1,38 @@
+/*******************************************************************/
+/***************     Author: Youssef_Farid		   *****************/
+/***************     Layer: MCAL                   *****************/
+/***************     ACOMP_private                 *****************/
+/*******************************************************************/
+
+#ifndef ACOMP_PRIVATE_H
+#define ACOMP_PRIVATE_H
+
+/**
+ * @brief Macros for the positive input options.
+ *
+ * - ACOMP_AIN0: The AIN0 pin (PB2).
+ * - ACOMP_BANDGAP: The internal bandgap reference (about 1.23 V).
+ */
+#define ACOMP_AIN0          1u
+#define ACOMP_BANDGAP       2u
+
+/**
+ * @brief Macros for the interrupt mode options.
+ *
+ * These macros are the ACIS1:0 values of ACSR. The comparator output (ACO) is high when the positive
+ * input is above the negative input (AIN1):
+ * - ACOMP_TOGGLE: Interrupt on any output change.
+ * - ACOMP_FALLING: Interrupt when the output falls (AIN1 rises above the positive input).
+ * - ACOMP_RISING: Interrupt when the output rises (AIN1 falls below the positive input).
+ *
+ * ACOMP_Mode_Bit_Mask is used to clear the ACIS bits, and ACOMP_Mode_Bit_Pos defines the bit position
+ * for setting the mode.
+ */
+#define ACOMP_TOGGLE        0u
+#define ACOMP_FALLING       2u
+#define ACOMP_RISING        3u
+
+#define ACOMP_Mode_Bit_Mask 0b11111100
+#define ACOMP_Mode_Bit_Pos  0u
+
+#endif
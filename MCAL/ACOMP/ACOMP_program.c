@@ -0,0 +1,129 @@
+/*******************************************************************/
+/***************     Author: Youssef_Farid		   *****************/
+/***************     Layer: MCAL                   *****************/
+/***************     ACOMP_program                 *****************/
+/*******************************************************************/
+
+#include "STD_TYPES.h"
+#include "BIT_math.h"
+
+#include "ACOMP_register.h"
+#include "ACOMP_private.h"
+#include "ACOMP_config.h"
+#include "ACOMP_interface.h"
+
+#include <util/delay.h>
+
+/* 
+ * Analog Comparator Driver for an AVR Microcontroller
+ * 
+ * This driver compares the AIN1 pin against AIN0 or the internal bandgap and calls an application
+ * callback from the comparator interrupt when the configured edge occurs. A threshold watched this
+ * way needs no ADC conversion and no main loop pass to be detected.
+ */
+
+/* Global Variables */
+static void (*ACOMP_pvCallBackFunc)(void) = NULL;  // Callback function pointer for the comparator interrupt
+
+/*
+ * Function: ACOMP_voidInit
+ * ------------------------
+ * Powers the comparator with the configured positive input and interrupt mode, and enables
+ * the comparator interrupt. For an edge mode, the callback is called once right away if the output
+ * is already at the level the edge leads to.
+ */
+void ACOMP_voidInit(void) {
+    /* The interrupt must be off while the comparator is reconfigured, or it may fire spuriously */
+    CLR_BIT(ACSR, ACSR_ACIE);
+
+    /* Power the comparator, negative input on AIN1, no input capture */
+    CLR_BIT(ACSR, ACSR_ACD);
+    CLR_BIT(SFIOR, SFIOR_ACME);
+    CLR_BIT(ACSR, ACSR_ACIC);
+
+    /* Select the positive input */
+#if ACOMP_u8PositiveInput == ACOMP_AIN0
+    CLR_BIT(ACSR, ACSR_ACBG);
+#elif ACOMP_u8PositiveInput == ACOMP_BANDGAP
+    SET_BIT(ACSR, ACSR_ACBG);
+    _delay_us(ACOMP_u8BandgapSettleTime);
+#else
+#error "Wrong ACOMP_u8PositiveInput configuration option"
+#endif
+
+    /* Select the interrupt edge */
+    ACSR &= ACOMP_Mode_Bit_Mask;
+    ACSR |= ACOMP_u8InterruptMode << ACOMP_Mode_Bit_Pos;
+
+    /* Clear a flag raised while configuring, then enable the interrupt */
+    SET_BIT(ACSR, ACSR_ACI);
+    SET_BIT(ACSR, ACSR_ACIE);
+
+    /* An edge only comes when the output changes: if the condition already holds, no interrupt will
+     * report it, so the callback is called from here */
+#if ACOMP_u8InterruptMode == ACOMP_RISING
+    if ((GET_BIT(ACSR, ACSR_ACO) != 0u) && (ACOMP_pvCallBackFunc != NULL)) {
+        ACOMP_pvCallBackFunc();
+    }
+#elif ACOMP_u8InterruptMode == ACOMP_FALLING
+    if ((GET_BIT(ACSR, ACSR_ACO) == 0u) && (ACOMP_pvCallBackFunc != NULL)) {
+        ACOMP_pvCallBackFunc();
+    }
+#endif
+}
+
+/*
+ * Function: ACOMP_u8GetOutput
+ * ---------------------------
+ * Reads the comparator output (ACO).
+ *
+ * Returns:
+ *  - NO_ERROR if the output is read.
+ *  - NULL_PTR_ERR if the output pointer is NULL.
+ */
+u8 ACOMP_u8GetOutput(u8* Copy_pu8Output) {
+    u8 Local_u8ErrState = NO_ERROR;
+
+    if (Copy_pu8Output != NULL) {
+        *Copy_pu8Output = GET_BIT(ACSR, ACSR_ACO);
+    } else {
+        /* Null pointer error */
+        Local_u8ErrState = NULL_PTR_ERR;
+    }
+
+    return Local_u8ErrState;
+}
+
+/*
+ * Function: ACOMP_u8SetCallBack
+ * -----------------------------
+ * Sets the function called from the analog comparator ISR.
+ *
+ * Returns:
+ *  - NO_ERROR if the callback is set.
+ *  - NULL_PTR_ERR if the callback pointer is NULL.
+ */
+u8 ACOMP_u8SetCallBack(void(*Copy_pvCallBackFunc)(void)) {
+    u8 Local_u8ErrState = NO_ERROR;
+
+    if (Copy_pvCallBackFunc != NULL) {
+        ACOMP_pvCallBackFunc = Copy_pvCallBackFunc;
+    } else {
+        /* Null pointer error */
+        Local_u8ErrState = NULL_PTR_ERR;
+    }
+
+    return Local_u8ErrState;
+}
+
+/*
+ * Interrupt Service Routine (ISR) for the analog comparator
+ * ---------------------------------------------------------
+ * Entering this ISR clears ACI in hardware. The callback is invoked if one is set.
+ */
+void __vector_18(void) __attribute__((signal));
+void __vector_18(void) {
+    if (ACOMP_pvCallBackFunc != NULL) {
+        ACOMP_pvCallBackFunc();
+    }
+}
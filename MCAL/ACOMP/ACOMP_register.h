@@ -0,0 +1,47 @@
+/*******************************************************************/
+/***************     Author: Youssef_Farid		   *****************/
+/***************     Layer: MCAL                   *****************/
+/***************     ACOMP_register                *****************/
+/*******************************************************************/
+
+#ifndef ACOMP_REGISTER_H
+#define ACOMP_REGISTER_H
+
+/**
+ * @brief Macros for Analog Comparator Register and Bit Definitions.
+ */
+
+/**
+ * @brief Analog Comparator Control and Status Register (ACSR).
+ *
+ * - ACSR_ACD (Bit 7): Analog Comparator Disable.
+ * - ACSR_ACBG (Bit 6): Analog Comparator Bandgap Select (bandgap on the positive input instead of AIN0).
+ * - ACSR_ACO (Bit 5): Analog Comparator Output.
+ * - ACSR_ACI (Bit 4): Analog Comparator Interrupt Flag.
+ * - ACSR_ACIE (Bit 3): Analog Comparator Interrupt Enable.
+ * - ACSR_ACIC (Bit 2): Analog Comparator Input Capture Enable.
+ * - ACIS1:0 (Bits 1:0): Analog Comparator Interrupt Mode Select.
+ *
+ * ACSR is located at address 0x28.
+ */
+#define ACSR                *((volatile u8*)0x28)  /**< Analog Comparator Control and Status Register */
+#define ACSR_ACD            7u                      /**< Analog Comparator Disable */
+#define ACSR_ACBG           6u                      /**< Analog Comparator Bandgap Select */
+#define ACSR_ACO            5u                      /**< Analog Comparator Output */
+#define ACSR_ACI            4u                      /**< Analog Comparator Interrupt Flag */
+#define ACSR_ACIE           3u                      /**< Analog Comparator Interrupt Enable */
+#define ACSR_ACIC           2u                      /**< Analog Comparator Input Capture Enable */
+#define ACSR_ACIS1          1u                      /**< Analog Comparator Interrupt Mode Select bit 1 */
+#define ACSR_ACIS0          0u                      /**< Analog Comparator Interrupt Mode Select bit 0 */
+
+/**
+ * @brief Special Function I/O Register (SFIOR).
+ *
+ * - SFIOR_ACME (Bit 3): Analog Comparator Multiplexer Enable (ADC multiplexer on the negative input).
+ *
+ * SFIOR is located at address 0x50.
+ */
+#define SFIOR               *((volatile u8*)0x50)  /**< Special Function I/O Register */
+#define SFIOR_ACME          3u                      /**< Analog Comparator Multiplexer Enable */
+
+#endif
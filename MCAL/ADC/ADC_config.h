@@ -30,17 +30,24 @@
  * Options:
  *  - _8_BIT: 8-bit resolution (the result is left-adjusted).
  *  - _10_BIT: 10-bit resolution (the result is right-adjusted).
+ *
+ * Scan entries with oversampling add their extra bits on top of this resolution.
  */
-#define ADC_u8Resolution                     _8_BIT  /**< ADC resolution option */
+#define ADC_u8Resolution                     _10_BIT  /**< ADC resolution option */
 
 /**
  * @brief Macro for selecting the ADC conversion mode.
  * 
  * Options:
- *  - Manual: Manual conversion mode (user initiates each conversion).
+ *  - Manual: Manual conversion mode (user initiates each conversion). A running scan is
+ *    re-armed from the ADC ISR, so it samples as fast as the ADC clock allows.
  *  - Auto_Trigger: Auto-trigger mode (conversion starts automatically based on a trigger source).
+ *    Only the scan engine is paced by the trigger source; single, chain and synchronous
+ *    conversions are still started by software. With Counter0_Compare_Match and TIMER0_voidInit,
+ *    every compare match converts one scan entry, so each channel is sampled at
+ *    (compare match rate) / (number of scanned channels) regardless of main-loop load.
  */
-#define ADC_u8Conv_Mode                      Manual  /**< ADC conversion mode option */
+#define ADC_u8Conv_Mode                      Auto_Trigger  /**< ADC conversion mode option */
 
 /**
  * @brief Macro for selecting the ADC prescaler division factor.
@@ -56,18 +63,127 @@
  */
 #define ADC_u8PrescalerDivisionFactor        Division_by_128  /**< Prescaler division factor option */
 
+/**
+ * @brief Macro for selecting the ADC prescaler division factor used during a burst capture.
+ * 
+ * A burst runs the ADC in free running mode, so the sample rate is (F_CPU / prescaler) / 13.
+ * At F_CPU = 16 MHz:
+ *  - Division_by_128: 125 kHz ADC clock, about 9.6 kSPS at full 10-bit accuracy.
+ *  - Division_by_64: 250 kHz ADC clock, about 19.2 kSPS, roughly 8 to 9 effective bits.
+ *  - Division_by_32: 500 kHz ADC clock, about 38.5 kSPS, roughly 8 effective bits or less.
+ * The datasheet only guarantees full resolution up to a 200 kHz ADC clock.
+ */
+#define ADC_u8BurstPrescalerDivisionFactor   Division_by_64  /**< Burst capture prescaler option */
+
 /**
  * @brief Macro to define the timeout period for ADC conversion in synchronous mode.
  */
 #define ADC_u32TimeOut                       50000u  /**< Timeout period for ADC conversion (in clock cycles) */
 
+/**
+ * @brief Macro to define the maximum number of entries in a scan list.
+ *
+ * The scan engine keeps a double-buffered result table of this size, so it bounds both the
+ * RAM used by the driver (4 bytes per entry) and the longest list accepted by ADC_u8StartScan.
+ * The ATmega32 has 8 single-ended inputs.
+ */
+#define ADC_u8ScanMaxChannels                8u  /**< Maximum number of scanned channels */
+
+/**
+ * @brief Macro to define the number of window events the scan can hold until they are read.
+ *
+ * Must be a power of two, 2 to 128. Each event takes 4 bytes of RAM.
+ */
+#define ADC_u8WindowEventQueueSize           8u  /**< Window event ring size */
+
+/**
+ * @brief Macro to define how many injected conversion requests can be pending at the same time.
+ *
+ * Must be a power of two, 2 to 128. Each request takes 5 bytes of RAM.
+ */
+#define ADC_u8InjectQueueDepth               4u  /**< Injected conversion queue depth */
+
+/**
+ * @brief Macros to define how many conversions are discarded after the scan switches the reference.
+ *
+ * The first result after a reference change is inaccurate. Switching to the internal reference, the
+ * capacitor on AREF also has to charge or discharge through the 32 kOhm reference output (about 3 ms time
+ * constant with 100 nF): with one conversion per 1 ms Timer/Counter0 tick, 32 discards allow about 10 time
+ * constants, and in Manual mode (about 104 us per conversion) the value must be about 10 times larger.
+ * AVCC and AREF drive the pin directly, so switching to them only needs the first results dropped.
+ * Slots where the scan is parked (see ADC_u8ScanSkipIdleSlots) count towards the settling.
+ */
+#define ADC_u8RefSettleConversions           32u  /**< Conversions discarded after switching to the internal reference */
+#define ADC_u8DirectRefSettleConversions     2u   /**< Conversions discarded after switching to AVCC or AREF */
+
+/**
+ * @brief Macro to define how many conversions are discarded after the scan switches to a 10x or 200x input.
+ *
+ * The first result on a gain input is inaccurate while the offset cancellation of the gain stage settles.
+ */
+#define ADC_u8GainSettleConversions          1u  /**< Conversions discarded after selecting a gain input */
+
+/**
+ * @brief Macros for the reference voltages and the auto-ranging switch points, in millivolts.
+ *
+ * ADC_u16AvccMilliVolts is the nominal AVCC, used until the scan has measured the supply.
+ *
+ * An ADC_REF_AUTO scan entry converts with the internal 2.56 V reference while its input is below
+ * ADC_u16AutoRangeUpMilliVolts and with AVCC above it, coming back below ADC_u16AutoRangeDownMilliVolts.
+ * Up must stay below the internal reference so that a rising input is caught before it clips.
+ */
+#define ADC_u16AvccMilliVolts                5000u  /**< AVCC voltage (in millivolts) */
+#define ADC_u16InternalMilliVolts            2560u  /**< Internal reference voltage (in millivolts) */
+#define ADC_u16AutoRangeUpMilliVolts         2400u  /**< Switch to AVCC above this input (in millivolts) */
+#define ADC_u16AutoRangeDownMilliVolts       2200u  /**< Switch to the internal reference below this input (in millivolts) */
+
+/**
+ * @brief Macros for the supply measurement.
+ *
+ * Every ADC_u16SupplyPeriod scan slots the scan converts the internal bandgap against AVCC (16 conversions)
+ * and derives the real AVCC voltage from it; 0 disables the measurement. The bandgap voltage varies from
+ * part to part (1.15 V to 1.35 V on the ATmega32), so ADC_u16BandgapMilliVolts can be set to the value
+ * measured on the board. The first conversions after selecting the bandgap are discarded while it settles.
+ */
+#define ADC_u16SupplyPeriod                  1000u  /**< Scan slots between two supply measurements */
+#define ADC_u16BandgapMilliVolts             1220u  /**< Bandgap voltage (in millivolts) */
+#define ADC_u8BandgapSettleConversions       2u     /**< Conversions discarded after selecting the bandgap */
+
+/**
+ * @brief Macros for the adaptive period of the scan entries.
+ *
+ * After ADC_u8AdaptiveStableResults results in a row that each moved by at most ADC_u16AdaptiveDelta from
+ * the previous one, an entry's period doubles, up to its Period << ADC_u8AdaptiveMaxShift. A larger step
+ * drops it back to Period at once. ADC_u16AdaptiveDelta is in LSBs of the configured resolution; it is
+ * scaled by each entry's oversampling, so it means the same input change on every entry.
+ * ADC_u8AdaptiveMaxShift = 0 keeps every entry at its Period.
+ */
+#define ADC_u8AdaptiveMaxShift               4u  /**< Largest period multiplier, as a power of two (0 .. 15) */
+#define ADC_u8AdaptiveStableResults          8u  /**< Stable results before the period doubles */
+#define ADC_u16AdaptiveDelta                 2u  /**< Largest step of a stable result (in LSBs) */
+
+/**
+ * @brief Macro to select what the scan does in the slots where no entry is due (Auto_Trigger mode only).
+ *
+ * Options:
+ *  - 1u: The trigger is left un-armed until the next due slot, so the idle slots cost no conversion. The
+ *    slots are then counted by ADC_voidScanTick, which must be called from the trigger source's interrupt
+ *    (for example as the Timer/Counter0 callback).
+ *  - 0u: Every slot converts; the result of an idle slot is discarded.
+ */
+#define ADC_u8ScanSkipIdleSlots              1u  /**< Skip the idle scan slots */
+
 #if ADC_u8Conv_Mode == Auto_Trigger
 
 /**
  * @brief Macro for selecting the ADC trigger source when auto-trigger mode is enabled.
  * 
+ * Each trigger event converts the scan entry selected by the previous ISR. The trigger period
+ * must be longer than one conversion (13.5 ADC clocks, about 108 us at Division_by_128).
+ * 
  * Options:
- *  - Free_Running_mode: Free running mode (continuous conversion).
+ *  - Free_Running_mode: Free running mode (continuous conversion). Not supported for scans, since
+ *    the next conversion starts before the ISR can select the next channel; use Manual instead.
  *  - Analog_Comparator: Triggered by the analog comparator.
  *  - External_Interrupt_Request_0: Triggered by external interrupt request 0.
  *  - Counter0_Compare_Match: Triggered by Timer/Counter0 compare match.
@@ -76,7 +192,7 @@
  *  - Counter1_Overflow: Triggered by Timer/Counter1 overflow.
  *  - Counter1_Capture_Event: Triggered by Timer/Counter1 capture event.
  */
-#define ADC_u8TriggerSource                  Free_Running_mode  /**< ADC trigger source option */
+#define ADC_u8TriggerSource                  Counter0_Compare_Match  /**< ADC trigger source option */
 
 
 #endif
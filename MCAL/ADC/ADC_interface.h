@@ -7,6 +7,175 @@
 #ifndef ADC_INTERFACE_H
 #define ADC_INTERFACE_H
 
+/**
+ * @brief Structure describing one entry of a scan list.
+ *
+ * A scan list is an array of these entries passed to ADC_u8StartScan. The scan engine converts
+ * the entries that are due in round robin order; an entry is due again Period scan slots after
+ * it was last started. Fields left out of an initializer are 0, which turns the matching stage off
+ * and samples the entry as often as possible.
+ */
+typedef struct
+{
+    u8 Channel;       /**< MUX code to convert (ADC_CH_ADC0 .. ADC_CH_GND, see ADC_u8GetDifferentialChannel). */
+    u8 Oversampling;  /**< Oversampling option (ADC_OVERSAMPLING_OFF .. ADC_OVERSAMPLING_X64). */
+    u8 Median;        /**< Spike rejection window (ADC_MEDIAN_OFF, ADC_MEDIAN_3 or ADC_MEDIAN_5). */
+    u8 FilterShift;   /**< Exponential filter strength k, y += (x - y) / 2^k (0 disables the filter). */
+    u16 WindowLow;    /**< Lower window threshold, in the entry's result units (see ADC_u8GetWindowEvent). */
+    u16 WindowHigh;   /**< Upper window threshold; WindowLow = WindowHigh = 0 disables the window. */
+    u16 Hysteresis;   /**< Distance past a threshold needed to change zone, in result units. */
+    u16 Period;       /**< Fastest scan slots between two results of the entry (0 or 1 = as often as possible). */
+    u8 Reference;     /**< Reference of the entry (ADC_REF_DEFAULT .. ADC_REF_AUTO). */
+    u8 AutoZero;      /**< 1 to subtract the offset of a differential entry from every result, 0 otherwise. */
+} ADC_ScanChannel_t;
+
+/**
+ * @brief Structure holding the calibration of one scan entry.
+ *
+ * A filtered result x of the entry becomes ((x - Offset) * Gain) >> ADC_CAL_GAIN_SHIFT, clamped to
+ * 0 .. 65535, before its window is checked and it is stored. Offset is in the entry's result units and
+ * Gain is unsigned Q2.14, so ADC_CAL_GAIN_ONE is a gain of 1 and the largest gain is just under 4.
+ */
+typedef struct
+{
+    s16 Offset;       /**< Result of the entry that corresponds to 0, in result units. */
+    u16 Gain;         /**< Gain in Q2.14 (ADC_CAL_GAIN_ONE = 1.0). */
+} ADC_Calibration_t;
+
+/**
+ * @brief Structure describing a differential input.
+ *
+ * It is resolved to the MUX code of the pair by ADC_u8GetDifferentialChannel.
+ */
+typedef struct
+{
+    u8 Positive;      /**< Positive input (0..7 for ADC0..ADC7). */
+    u8 Negative;      /**< Negative input (0..7 for ADC0..ADC7). */
+    u8 Gain;          /**< Gain of the pair (ADC_GAIN_X1, ADC_GAIN_X10 or ADC_GAIN_X200). */
+} ADC_Differential_t;
+
+/**
+ * @brief Structure describing one window event.
+ *
+ * An event is posted by the scan ISR when the filtered result of an entry moves into a new zone.
+ */
+typedef struct
+{
+    u8 Entry;         /**< Position of the entry in the scan list. */
+    u8 Zone;          /**< New zone of the entry (ADC_ZONE_BELOW, ADC_ZONE_INSIDE or ADC_ZONE_ABOVE). */
+    u16 Value;        /**< Filtered result that caused the zone change. */
+} ADC_WindowEvent_t;
+
+/**
+ * @brief Oversampling options for a scan entry.
+ *
+ * An option n converts the channel 4^n times back to back, sums the results and shifts the sum right
+ * by n, so the entry's result gains n bits over the configured ADC resolution (10-bit + 2 = 12-bit
+ * for ADC_OVERSAMPLING_X16). The extra bits are only real if the input carries at least 1 LSB of noise.
+ * The entry's sample rate drops by the same factor of 4^n.
+ */
+#define ADC_OVERSAMPLING_OFF    0u  /**< 1 conversion per result, no extra bits. */
+#define ADC_OVERSAMPLING_X4     1u  /**< 4 conversions per result, 1 extra bit. */
+#define ADC_OVERSAMPLING_X16    2u  /**< 16 conversions per result, 2 extra bits. */
+#define ADC_OVERSAMPLING_X64    3u  /**< 64 conversions per result, 3 extra bits. */
+
+/**
+ * @brief Median filter options for a scan entry.
+ *
+ * The median of the last 3 or 5 results of the entry replaces the current result, so a single spike
+ * (or two, with ADC_MEDIAN_5) never reaches the output. It adds a delay of 1 or 2 results.
+ *
+ * The median output then goes through the exponential filter selected by FilterShift. The filter's
+ * time constant is about 2^FilterShift results. Its state is kept in 16 bits, so the result bits
+ * (ADC resolution + oversampling) plus FilterShift must not exceed 16.
+ */
+#define ADC_MEDIAN_OFF          0u  /**< No median filter. */
+#define ADC_MEDIAN_3            3u  /**< Median of the last 3 results. */
+#define ADC_MEDIAN_5            5u  /**< Median of the last 5 results. */
+
+/**
+ * @brief Reference options for a scan entry.
+ *
+ * Every scan entry can convert against its own reference; the scan switches the REFS bits between
+ * entries and discards conversions after every switch while the new reference settles (many for the internal
+ * reference, a few for AVCC or AREF; see ADC_config.h), so mixing references in one list costs conversion slots.
+ *
+ * An ADC_REF_AUTO entry uses the internal 2.56 V reference while its input is low and AVCC when it is
+ * high (see ADC_u16AutoRangeUpMilliVolts). Its results are always in internal reference counts: a
+ * result taken on AVCC is scaled by the measured AVCC / 2.56 V, so it can go up to about twice the full scale of the
+ * resolution. The entry gets about twice the resolution below 2.4 V without changing its scale, its
+ * filter or its window. ADC_u8GetScanReference returns the range in use.
+ *
+ * ADC_REF_INTERNAL and ADC_REF_AUTO need AREF decoupled by a capacitor only, with no external
+ * voltage applied.
+ */
+#define ADC_REF_DEFAULT         0u  /**< The reference configured by ADC_u8Voltage_Ref. */
+#define ADC_REF_AREF            1u  /**< External reference on the AREF pin. */
+#define ADC_REF_AVCC            2u  /**< AVCC. */
+#define ADC_REF_INTERNAL        3u  /**< Internal 2.56 V reference. */
+#define ADC_REF_AUTO            4u  /**< Internal 2.56 V for low inputs, AVCC for high inputs. */
+
+/**
+ * @brief MUX codes of the single-ended and fixed inputs.
+ *
+ * Every API taking a channel takes the 5-bit MUX code, so these and the codes returned by
+ * ADC_u8GetDifferentialChannel can be used anywhere.
+ */
+#define ADC_CH_ADC0             0x00u  /**< Single-ended ADC0 (PA0). */
+#define ADC_CH_ADC1             0x01u  /**< Single-ended ADC1 (PA1). */
+#define ADC_CH_ADC2             0x02u  /**< Single-ended ADC2 (PA2). */
+#define ADC_CH_ADC3             0x03u  /**< Single-ended ADC3 (PA3). */
+#define ADC_CH_ADC4             0x04u  /**< Single-ended ADC4 (PA4). */
+#define ADC_CH_ADC5             0x05u  /**< Single-ended ADC5 (PA5). */
+#define ADC_CH_ADC6             0x06u  /**< Single-ended ADC6 (PA6). */
+#define ADC_CH_ADC7             0x07u  /**< Single-ended ADC7 (PA7). */
+#define ADC_CH_BANDGAP          0x1Eu  /**< Internal 1.22 V bandgap (VBG). */
+#define ADC_CH_GND              0x1Fu  /**< 0 V (GND). */
+
+/**
+ * @brief Gain options for a differential input.
+ *
+ * The ATmega32 only has these pairs:
+ * - ADC_GAIN_X10 and ADC_GAIN_X200: ADC0 or ADC1 against ADC0, ADC2 or ADC3 against ADC2.
+ * - ADC_GAIN_X1: ADC0..ADC7 against ADC1, ADC0..ADC5 against ADC2.
+ *
+ * A differential result is (Vpos - Vneg) * Gain * 2^(bits - 1) / Vref, signed. The driver returns it in
+ * offset binary: 2^(bits - 1) is 0 V, 0 is the negative full scale and 2^bits - 1 the positive one, so it
+ * goes through oversampling, the filters and the window like any other result. ADC_s16GetSignedResult
+ * turns it into a signed value.
+ *
+ * @note The datasheet only guarantees the differential inputs in the TQFP and QFN/MLF packages. With
+ *       ADC_GAIN_X200 the effective resolution is about 7 bits.
+ */
+#define ADC_GAIN_X1             1u    /**< Unity gain. */
+#define ADC_GAIN_X10            10u   /**< Gain of 10. */
+#define ADC_GAIN_X200           200u  /**< Gain of 200. */
+
+/**
+ * @brief Window zones of a scan entry.
+ *
+ * The window [WindowLow, WindowHigh] splits the result range into three zones. An entry leaves its zone
+ * only when the result goes past the threshold by more than its Hysteresis:
+ * - to ADC_ZONE_BELOW when the result is below WindowLow - Hysteresis,
+ * - to ADC_ZONE_ABOVE when the result is above WindowHigh + Hysteresis,
+ * - from below or above to ADC_ZONE_INSIDE when the result is back above WindowLow + Hysteresis or
+ *   below WindowHigh - Hysteresis.
+ * The first result of an entry after the scan starts always posts its zone, without hysteresis.
+ */
+#define ADC_ZONE_BELOW          0u  /**< Result below the window. */
+#define ADC_ZONE_INSIDE         1u  /**< Result inside the window. */
+#define ADC_ZONE_ABOVE          2u  /**< Result above the window. */
+
+/**
+ * @brief Calibration constants.
+ *
+ * - ADC_CAL_GAIN_SHIFT, ADC_CAL_GAIN_ONE: fraction bits of the calibration gain, and the gain of 1.
+ * - ADC_CAL_POINT_1, ADC_CAL_POINT_2: the two points of ADC_u8CalibratePoint.
+ */
+#define ADC_CAL_GAIN_SHIFT      14u
+#define ADC_CAL_GAIN_ONE        16384u
+#define ADC_CAL_POINT_1         1u
+#define ADC_CAL_POINT_2         2u
 
 /**
  * @brief Initialize the ADC registers.
@@ -16,7 +185,8 @@
  * configuration file (ADC_config.h). This includes selecting the voltage reference, 
  * resolution (8-bit or 10-bit), prescaler, and conversion mode (manual or auto-trigger).
  * 
- * After initialization, the ADC is ready for conversion.
+ * After initialization, the ADC is ready for conversion. Every scan entry starts uncalibrated
+ * (offset 0, gain ADC_CAL_GAIN_ONE).
  */
 void ADC_voidInit(void);
 
@@ -41,6 +211,30 @@ void ADC_voidInit(void);
  */
 u8 ADC_u8StartConversionSynch(u8 Copy_u8Channel, u16* Copy_pu16Result);
 
+/**
+ * @brief Convert a channel with the CPU in ADC Noise Reduction sleep.
+ *
+ * This function is a precision alternative to ADC_u8StartConversionSynch. Instead of polling, it puts the
+ * microcontroller into ADC Noise Reduction sleep; entering that mode starts the conversion, and the ADC
+ * interrupt wakes the CPU when the result is ready (about 104 us at Division_by_128). With the CPU and I/O
+ * clocks stopped, less digital switching noise couples into the measurement and less current is drawn.
+ *
+ * The choice is made per request: call this function for readings that need the best LSBs, and
+ * ADC_u8StartConversionSynch or the asynchronous API for the rest.
+ *
+ * @note Global interrupts must be enabled, and the ADC must not be running a scan.
+ * @note Timer/Counter0 and the other I/O-clocked peripherals are frozen during the conversion.
+ *
+ * @param Copy_u8Channel: The ADC channel to start the conversion on (refer to the datasheet for channel numbers).
+ * @param Copy_pu16Result: Pointer to store the result of the conversion.
+ * @return u8: Status of the operation:
+ * - '0u' on success,
+ * - '1u' if global interrupts are disabled,
+ * - '2u' if the result pointer is NULL,
+ * - '4u' if the ADC is already busy with another conversion.
+ */
+u8 ADC_u8StartConversionSleep(u8 Copy_u8Channel, u16* Copy_pu16Result);
+
 /**
  * @brief Start ADC conversion in asynchronous mode.
  *
@@ -80,6 +274,7 @@ u8 ADC_u8StartConversionAsynch(u8 Copy_u8Channel, u16* Copy_pu16Result, void(*Co
  * @param Copy_pvNotificationFunc: Function pointer to the callback function that will be called when all conversions are complete.
  * @return u8: Status of the operation:
  * - '0u' on success,
+ * - '1u' if the number of channels is 0,
  * - '2u' if any of the pointers (channel array, result array, or callback function) are NULL,
  * - '4u' if the ADC is already busy with another conversion.
  *
@@ -87,4 +282,316 @@ u8 ADC_u8StartConversionAsynch(u8 Copy_u8Channel, u16* Copy_pu16Result, void(*Co
  * without blocking the main program execution.
  */
 u8 ADC_u8StartChainConvAsynch(u8 Copy_u8NumOfChannels, u8* Copy_u8Channels, u16* Copy_pu16Results, void(*Copy_pvNotificationFunc)(void));
+
+/**
+ * @brief Start a continuous scan over a list of channels.
+ *
+ * This function starts the scan engine: the first conversion is started here, and from then on the ADC
+ * interrupt stores each result, moves a cursor to the next due entry of the list and immediately starts the
+ * next conversion. The application never has to restart the scan.
+ *
+ * Each result goes through the entry's filter pipeline (oversampling, median, exponential filter) in the
+ * ISR, is checked against the entry's window (if any) and is then written into a double-buffered table.
+ * When a pass ends, the freshly written buffer is published, so ADC_u8GetScanResult always returns filtered values from the last complete pass.
+ *
+ * Every conversion is one scan slot. In Manual conversion mode a slot is 13 ADC clocks, about 104 us
+ * with F_CPU = 16 MHz and Division_by_128. In Auto_Trigger conversion mode a slot is one trigger event
+ * (1 ms with the default Timer/Counter0 setup), independent of how long the main loop takes; the trigger
+ * source (for example Timer/Counter0 through TIMER0_voidInit) must be running.
+ *
+ * Each entry is started again Period slots after its last start, so different sensors can be sampled at
+ * different rates from the same slot clock and slow sensors do not use up conversions. While an entry's
+ * results stay stable its period backs off exponentially, up to Period << ADC_u8AdaptiveMaxShift, and it
+ * returns to Period as soon as a result steps by more than ADC_u16AdaptiveDelta (see ADC_config.h). When several
+ * entries are due they are served in round robin order; when none is due, the trigger is left un-armed
+ * until the next due slot (or, with ADC_u8ScanSkipIdleSlots = 0, the slot runs an idle conversion whose
+ * result is discarded). An oversampled entry holds the ADC for its 4^n conversions, so
+ * the periods of the other entries stretch while it runs. If the due entries need more slots than
+ * there are, every entry is simply served in turn.
+ *
+ * A pass ends when the round robin wraps or nothing is due. Entries that were not converted in a pass
+ * keep their previous result in the published table.
+ *
+ * An entry can convert a differential input (see ADC_GAIN_X1). With AutoZero set, the entry first converts
+ * its negative input against itself at the same gain, as many times as the entry itself, and every result
+ * has that offset subtracted, so the offset of the gain stage and its drift never reach the result. This
+ * doubles the conversions of the entry. When the scan switches to a 10x or 200x input,
+ * ADC_u8GainSettleConversions conversions are discarded while the gain stage settles.
+ *
+ * @note Global interrupts must be enabled for this function to work.
+ *
+ * @param Copy_u8NumOfChannels: Number of entries in the scan list (1 .. ADC_u8ScanMaxChannels).
+ * @param Copy_pstChannels: Pointer to the scan list. The list is not copied and must stay valid while the scan runs.
+ * @param Copy_pvNotificationFunc: Optional callback called from the ISR after every complete pass (may be NULL).
+ * @return u8: Status of the operation:
+ * - '0u' on success,
+ * - '1u' if the number of channels is 0 or larger than ADC_u8ScanMaxChannels, a channel, oversampling, filter or
+ *   reference option is invalid, an entry's WindowLow is above its WindowHigh, or a differential entry uses
+ *   ADC_REF_AUTO or a single-ended entry sets AutoZero,
+ * - '2u' if the scan list pointer is NULL,
+ * - '4u' if the ADC is already busy with another conversion.
+ */
+u8 ADC_u8StartScan(u8 Copy_u8NumOfChannels, const ADC_ScanChannel_t* Copy_pstChannels, void(*Copy_pvNotificationFunc)(void));
+
+/**
+ * @brief Stop the continuous scan.
+ *
+ * This function stops the scan engine after the conversion in flight and releases the ADC for other
+ * requests, on the configured reference. The results of the last complete pass stay readable. Injected
+ * requests that have not completed are dropped.
+ */
+void ADC_voidStopScan(void);
+
+/**
+ * @brief Count one scan slot while no entry is due.
+ *
+ * With ADC_u8ScanSkipIdleSlots set, the scan leaves the auto trigger un-armed while nothing is due, so no
+ * conversion counts the slots. This function has to be called once per trigger event instead, from the
+ * trigger source's interrupt (for example TIMER0_u8SetCallBack(&ADC_voidScanTick)). It does nothing while
+ * the scan runs its conversions, or when ADC_u8ScanSkipIdleSlots is 0.
+ */
+void ADC_voidScanTick(void);
+
+/**
+ * @brief Request a high-priority conversion, ahead of a running scan.
+ *
+ * While a scan is running, the request is queued (up to ADC_u8InjectQueueDepth requests) and the ADC
+ * interrupt converts it right after the conversion in flight, before the remaining scan entries. The scan
+ * then resumes on the entry it was on, so its results and filters are not disturbed; it only loses the
+ * time of the injected conversions. The latency of a request is therefore bounded by the conversion in
+ * flight plus the requests queued before it (about 104 us each with F_CPU = 16 MHz and Division_by_128).
+ *
+ * When the ADC is idle, the request starts at once, like ADC_u8StartConversionAsynch.
+ * While a scan runs, the request converts with the reference the scan has selected at that moment.
+ *
+ * Requests still queued when ADC_voidStopScan is called are dropped and their callbacks are not called.
+ *
+ * @note This function must be called from the main loop, not from an ISR.
+ *
+ * @param Copy_u8Channel: The ADC channel to convert.
+ * @param Copy_pu16Result: Pointer to store the result of the conversion.
+ * @param Copy_pvNotificationFunc: Callback called from the ISR once the result is stored.
+ * @return u8: Status of the operation:
+ * - '0u' on success,
+ * - '2u' if any pointer is NULL,
+ * - '4u' if the queue is full, or the ADC is busy with a request other than a scan.
+ */
+u8 ADC_u8InjectConversion(u8 Copy_u8Channel, u16* Copy_pu16Result, void(*Copy_pvNotificationFunc)(void));
+
+/**
+ * @brief Read a result from the last complete scan pass.
+ *
+ * @param Copy_u8Index: Position of the channel in the scan list.
+ * @param Copy_pu16Result: Pointer to store the result.
+ * @return u8: Status of the operation:
+ * - '0u' on success,
+ * - '1u' if the index is out of range or no pass has completed yet,
+ * - '2u' if the result pointer is NULL.
+ */
+u8 ADC_u8GetScanResult(u8 Copy_u8Index, u16* Copy_pu16Result);
+
+/**
+ * @brief Copy a consistent snapshot of the last complete scan pass.
+ *
+ * This function copies the results of every scan list entry, all taken from the same pass. It uses a
+ * sequence counter that the ISR increments on every published pass: the copy is retried if the counter
+ * changed while copying. Global interrupts are never disabled and the ISR does no extra work for readers.
+ *
+ * The returned sequence number can be compared with the previous one to skip processing when no new
+ * pass has been published.
+ *
+ * @param Copy_pu16Results: Array with at least as many elements as the scan list, receives the results.
+ * @param Copy_pu8Sequence: Optional pointer to receive the pass sequence number (may be NULL).
+ * @return u8: Status of the operation:
+ * - '0u' on success,
+ * - '1u' if no pass has completed yet,
+ * - '2u' if the result array pointer is NULL.
+ */
+u8 ADC_u8GetScanSnapshot(u16* Copy_pu16Results, u8* Copy_pu8Sequence);
+
+/**
+ * @brief Start a burst capture into a ring buffer.
+ *
+ * This function runs the ADC in free running mode on one channel, at the rate set by
+ * ADC_u8BurstPrescalerDivisionFactor (about 19.2 kSPS with the default Division_by_64), and the ADC
+ * interrupt pushes every result into the ring buffer. Main code drains the ring with
+ * ADC_u8ReadBurstSample while the capture runs; the producer and consumer indices are each written by one
+ * side only, so no interrupt locking is needed.
+ *
+ * When the ring is full, new samples are dropped and counted (see ADC_u16GetBurstOverruns).
+ *
+ * @note Global interrupts must be enabled, and the ADC must not be running a scan.
+ *
+ * @param Copy_u8Channel: The ADC channel to capture.
+ * @param Copy_pu16Buffer: Ring buffer, must stay valid until the burst is stopped and drained.
+ * @param Copy_u8BufferSize: Number of samples in the ring, a power of two from 2 to 128.
+ * @return u8: Status of the operation:
+ * - '0u' on success,
+ * - '1u' if the buffer size is not a power of two between 2 and 128,
+ * - '2u' if the buffer pointer is NULL,
+ * - '4u' if the ADC is already busy with another conversion.
+ */
+u8 ADC_u8StartBurst(u8 Copy_u8Channel, u16* Copy_pu16Buffer, u8 Copy_u8BufferSize);
+
+/**
+ * @brief Stop a burst capture.
+ *
+ * This function stops the free running conversions, restores the configured prescaler and trigger source
+ * and releases the ADC. Samples still in the ring can be drained afterwards.
+ */
+void ADC_voidStopBurst(void);
+
+/**
+ * @brief Take the oldest sample out of the burst ring buffer.
+ *
+ * @param Copy_pu16Sample: Pointer to store the sample.
+ * @return u8: Status of the operation:
+ * - '0u' on success,
+ * - '1u' if the ring is empty,
+ * - '2u' if the sample pointer is NULL.
+ */
+u8 ADC_u8ReadBurstSample(u16* Copy_pu16Sample);
+
+/**
+ * @brief Get the number of burst samples dropped because the ring was full.
+ *
+ * The counter is reset by ADC_u8StartBurst. A non-zero value means the ring is too small for how often
+ * the application drains it.
+ *
+ * @return u16: Number of dropped samples.
+ */
+u16 ADC_u16GetBurstOverruns(void);
+
+/**
+ * @brief Take the oldest window event posted by the scan.
+ *
+ * The scan ISR compares the filtered result of every entry that has a window against its thresholds
+ * and posts an event only when the entry changes zone. The application can react to these events
+ * instead of comparing every result in the main loop.
+ *
+ * The events are kept in a ring of ADC_u8WindowEventQueueSize entries. When the ring is full, new events
+ * are dropped; ADC_u8GetWindowZone still returns the current zone of every entry.
+ *
+ * @param Copy_pstEvent: Pointer to store the event.
+ * @return u8: Status of the operation:
+ * - '0u' on success,
+ * - '1u' if no event is pending,
+ * - '2u' if the event pointer is NULL.
+ */
+u8 ADC_u8GetWindowEvent(ADC_WindowEvent_t* Copy_pstEvent);
+
+/**
+ * @brief Get the current window zone of a scan entry.
+ *
+ * @param Copy_u8Index: Position of the entry in the scan list.
+ * @param Copy_pu8Zone: Pointer to store the zone (ADC_ZONE_BELOW, ADC_ZONE_INSIDE or ADC_ZONE_ABOVE).
+ * @return u8: Status of the operation:
+ * - '0u' on success,
+ * - '1u' if the index is out of range, the entry has no window, or it has no result yet,
+ * - '2u' if the zone pointer is NULL.
+ */
+u8 ADC_u8GetWindowZone(u8 Copy_u8Index, u8* Copy_pu8Zone);
+
+/**
+ * @brief Get the reference a scan entry currently converts with.
+ *
+ * For an ADC_REF_AUTO entry this is the range in use; its results are in internal reference counts
+ * either way.
+ *
+ * @param Copy_u8Index: Position of the entry in the scan list.
+ * @param Copy_pu8Reference: Pointer to store the reference (ADC_REF_AREF, ADC_REF_AVCC or ADC_REF_INTERNAL).
+ * @return u8: Status of the operation:
+ * - '0u' on success,
+ * - '1u' if the index is out of range,
+ * - '2u' if the reference pointer is NULL.
+ */
+u8 ADC_u8GetScanReference(u8 Copy_u8Index, u8* Copy_pu8Reference);
+
+/**
+ * @brief Get the AVCC voltage measured by the scan.
+ *
+ * While a scan runs it converts the internal bandgap against AVCC every ADC_u16SupplyPeriod slots and
+ * derives the real supply voltage in fixed point. AVCC-referenced results can be converted with it
+ * instead of the nominal 5 V; the AVCC range of ADC_REF_AUTO entries already is. Ratiometric sensors
+ * (a divider powered from AVCC, like the LDR) do not need it, since the supply cancels out.
+ *
+ * @param Copy_pu16MilliVolts: Pointer to store the supply voltage, in millivolts.
+ * @return u8: Status of the operation:
+ * - '0u' on success,
+ * - '1u' if the supply has not been measured yet,
+ * - '2u' if the pointer is NULL.
+ */
+u8 ADC_u8GetSupplyMilliVolts(u16* Copy_pu16MilliVolts);
+
+/**
+ * @brief Resolve a differential input to its MUX code.
+ *
+ * The returned code can be passed to any conversion function or used as the Channel of a scan entry.
+ *
+ * @param Copy_pstDifferential: Pointer to the differential input (positive and negative pins, gain).
+ * @param Copy_pu8Channel: Pointer to store the MUX code.
+ * @return u8: Status of the operation:
+ * - '0u' on success,
+ * - '1u' if the ATmega32 has no such pair at that gain (see ADC_GAIN_X1),
+ * - '2u' if any pointer is NULL.
+ */
+u8 ADC_u8GetDifferentialChannel(const ADC_Differential_t* Copy_pstDifferential, u8* Copy_pu8Channel);
+
+/**
+ * @brief Convert a differential result from offset binary to a signed value.
+ *
+ * @param Copy_u16Result: Result of a differential input, as returned by any conversion or scan function.
+ * @param Copy_u8Oversampling: Oversampling option the result was taken with (ADC_OVERSAMPLING_OFF outside a scan).
+ * @return s16: The signed result, from -2^(bits - 1) to 2^(bits - 1) - 1 (bits = resolution + oversampling).
+ */
+s16 ADC_s16GetSignedResult(u16 Copy_u16Result, u8 Copy_u8Oversampling);
+
+/**
+ * @brief Set the calibration of a scan entry.
+ *
+ * The calibration is applied by the scan ISR to every filtered result of the entry at that position of
+ * the scan list, before the window check, so the window thresholds and all scan results are calibrated.
+ * It costs one 32-bit multiply and shift per result (not per conversion), and is skipped for an
+ * uncalibrated entry. It stays in effect across ADC_u8StartScan calls.
+ *
+ * @param Copy_u8Index: Position of the entry in the scan list (0 .. ADC_u8ScanMaxChannels - 1).
+ * @param Copy_pstCalibration: Pointer to the calibration.
+ * @return u8: Status of the operation:
+ * - '0u' on success,
+ * - '1u' if the index is out of range or the gain is 0,
+ * - '2u' if the calibration pointer is NULL.
+ */
+u8 ADC_u8SetCalibration(u8 Copy_u8Index, const ADC_Calibration_t* Copy_pstCalibration);
+
+/**
+ * @brief Get the calibration of a scan entry.
+ *
+ * @param Copy_u8Index: Position of the entry in the scan list (0 .. ADC_u8ScanMaxChannels - 1).
+ * @param Copy_pstCalibration: Pointer to store the calibration.
+ * @return u8: Status of the operation:
+ * - '0u' on success,
+ * - '1u' if the index is out of range,
+ * - '2u' if the calibration pointer is NULL.
+ */
+u8 ADC_u8GetCalibration(u8 Copy_u8Index, ADC_Calibration_t* Copy_pstCalibration);
+
+/**
+ * @brief Capture one point of a two-point calibration of a running scan entry.
+ *
+ * Hold the sensor at a known value, let the entry's filter settle, then call this function with that
+ * value in result units: the entry's current filtered result before calibration is paired with it.
+ * ADC_CAL_POINT_1 only records the pair. ADC_CAL_POINT_2, with the same entry and another known value,
+ * derives the offset and gain that map both results onto their known values and applies them with
+ * ADC_u8SetCalibration. Store them (ADC_u8GetCalibration) to keep them across resets.
+ *
+ * @param Copy_u8Index: Position of the entry in the scan list.
+ * @param Copy_u8Point: ADC_CAL_POINT_1 or ADC_CAL_POINT_2.
+ * @param Copy_u16Known: The true value of the input, in the entry's result units.
+ * @return u8: Status of the operation:
+ * - '0u' on success,
+ * - '1u' if the entry has no result yet, the point is invalid, point 1 of the entry was not captured,
+ *   or the two points give no usable calibration (same result, or a gain that is not positive or not below 4).
+ */
+u8 ADC_u8CalibratePoint(u8 Copy_u8Index, u8 Copy_u8Point, u16 Copy_u16Known);
+
 #endif
@@ -92,7 +92,6 @@
  *
  * Usage: Choose the appropriate trigger source when Auto Trigger mode is enabled.
  */
-#if ADC_u8Conv_Mode == Auto_Trigger
 #define Free_Running_mode               0u
 #define Analog_Comparator               1u
 #define External_Interrupt_Request_0    2u
@@ -104,7 +103,6 @@
 
 #define Trigger_Source_Bit_Mask         0b00011111
 #define Trigger_Source_Bit_Pos          5u
-#endif
 
 /**
  * @brief Macro to clear the channel bits in the ADMUX register.
@@ -128,4 +126,265 @@
 #define IDLE  0u
 #define BUSY  1u
 
+/**
+ * @brief Macros to identify which request owns the ADC interrupt.
+ *
+ * These macros define what the ISR does with a finished conversion:
+ * - ADC_ISR_SINGLE: Single asynchronous conversion, store the result and call the callback.
+ * - ADC_ISR_CHAIN: Chain conversion, move on to the next channel of the chain.
+ * - ADC_ISR_SCAN: Continuous scan, store into the scan table and re-arm on the next entry.
+ * - ADC_ISR_SLEEP: Conversion during ADC Noise Reduction sleep, store the result and wake the caller.
+ * - ADC_ISR_BURST: Free running burst capture, push the result into the ring buffer.
+ */
+#define ADC_ISR_SINGLE  0u
+#define ADC_ISR_CHAIN   1u
+#define ADC_ISR_SCAN    2u
+#define ADC_ISR_SLEEP   3u
+#define ADC_ISR_BURST   4u
+
+/**
+ * @brief Macros for the sleep mode selection in MCUCR.
+ *
+ * - ADC_Noise_Reduction: SM2:0 value of the ADC Noise Reduction sleep mode. The CPU and I/O clocks stop
+ *   while the ADC keeps running, and entering the mode starts a conversion.
+ *
+ * Sleep_Mode_Bit_Mask is used to clear the SM2:0 bits (keeping the interrupt sense bits), and
+ * Sleep_Mode_Bit_Pos defines the bit position for setting the sleep mode.
+ */
+#define ADC_Noise_Reduction     1u
+#define Sleep_Mode_Bit_Mask     0b10001111
+#define Sleep_Mode_Bit_Pos      4u
+
+/**
+ * @brief Macro for the largest oversampling option accepted in a scan list.
+ *
+ * An option n accumulates 4^n conversions in a 16-bit sum, so n = 3 (64 conversions of at most
+ * 1023) is the largest that cannot overflow.
+ */
+#define Oversampling_Max  3u
+
+/**
+ * @brief Macro for the largest burst ring buffer size.
+ *
+ * The ring uses free-running 8-bit indices, and their difference must be able to represent a full ring.
+ */
+#define Burst_Max_Size  128u
+
+/**
+ * @brief Macro to clear the reference selection (REFS1:0) bits of ADMUX.
+ */
+#define Reference_Bit_Mask  0b00111111
+
+/**
+ * @brief Structure describing one queued injected conversion request.
+ */
+typedef struct
+{
+    u8 Channel;                         /**< ADC channel to convert. */
+    u16* Result;                        /**< Where to store the result. */
+    void (*NotificationFunc)(void);     /**< Callback invoked from the ISR once the result is stored. */
+} ADC_Inject_t;
+
+/**
+ * @brief Macro marking a scan slot in which no entry was due.
+ *
+ * It is stored in the sample counter while the ADC runs an idle conversion, whose result is discarded,
+ * and returned by ADC_u8ScanNextDue when no entry is due.
+ */
+#define ADC_SCAN_IDLE_SLOT  0xFFu
+
+/**
+ * @brief Macros for the supply measurement.
+ *
+ * - ADC_SCAN_SUPPLY_SLOT: Stored in the sample counter while the scan converts the bandgap.
+ * - ADC_BANDGAP_CHANNEL: MUX code of the internal bandgap (VBG) input.
+ * - ADC_SUPPLY_OVERSAMPLING: Oversampling option of the bandgap measurement (16 conversions, 2 extra bits).
+ */
+#define ADC_SCAN_SUPPLY_SLOT        0xFEu
+#define ADC_BANDGAP_CHANNEL         0b00011110
+#define ADC_SUPPLY_OVERSAMPLING     2u
+
+/**
+ * @brief Macros for the differential MUX codes.
+ *
+ * - ADC_FIRST_DIFF_CHANNEL .. ADC_LAST_DIFF_CHANNEL: the differential inputs, whose results are two's complement.
+ * - ADC_LAST_GAIN_CHANNEL: the 10x and 200x inputs are ADC_FIRST_DIFF_CHANNEL to this one, in pairs that share
+ *   the negative input and the gain, the first of each pair being that input against itself.
+ * - ADC_FIRST_NEG1_X1_CHANNEL, ADC_FIRST_NEG2_X1_CHANNEL: first 1x input against ADC1 and against ADC2, each
+ *   followed by the other positive pins in order.
+ * - ADC_X1_NEG1_ZERO_CHANNEL, ADC_X1_NEG2_ZERO_CHANNEL: ADC1 against ADC1 and ADC2 against ADC2, at 1x.
+ * - ADC_DIFF_MAX_PIN: highest input pin number.
+ */
+#define ADC_FIRST_DIFF_CHANNEL      0x08u
+#define ADC_LAST_GAIN_CHANNEL       0x0Fu
+#define ADC_FIRST_NEG1_X1_CHANNEL   0x10u
+#define ADC_FIRST_NEG2_X1_CHANNEL   0x18u
+#define ADC_LAST_DIFF_CHANNEL       0x1Du
+#define ADC_X1_NEG1_ZERO_CHANNEL    0x11u
+#define ADC_X1_NEG2_ZERO_CHANNEL    0x1Au
+#define ADC_DIFF_MAX_PIN            7u
+
+/**
+ * @brief Macro marking that no first calibration point is pending.
+ */
+#define ADC_CAL_NO_POINT    0xFFu
+
+/**
+ * @brief Macro for the window zone of an entry that has no result yet.
+ */
+#define ADC_ZONE_UNKNOWN  0xFFu
+
+/**
+ * @brief Macro to compare-exchange two values so that A <= B afterwards.
+ *
+ * This is the building block of the median networks used by the scan filter.
+ */
+#define ADC_CSWAP(A, B)  do { if ((A) > (B)) { u16 Local_u16Tmp = (A); (A) = (B); (B) = Local_u16Tmp; } } while (0)
+
+/**
+ * @brief Compiler memory barrier.
+ *
+ * The result table and the ring slots are not volatile, so the compiler may move their accesses across
+ * the volatile sequence and index accesses that guard them. The barrier keeps them in program order.
+ */
+#define ADC_MEMORY_BARRIER()  __asm__ __volatile__ ("" ::: "memory")
+
+/**
+ * @brief Select an ADC input channel.
+ *
+ * Clears the channel bits of ADMUX and writes the new channel, keeping the reference and
+ * adjustment bits as they are.
+ *
+ * @param Copy_u8Channel: The ADC channel (MUX code) to select.
+ */
+static void ADC_voidSelectChannel(u8 Copy_u8Channel);
+
+/**
+ * @brief Run one decimated scan result through its entry's median and exponential filters.
+ *
+ * @param Copy_u8Index: Position of the entry in the scan list.
+ * @param Copy_u16Sample: Decimated result of the entry.
+ * @return u16: The filtered result.
+ */
+static u16 ADC_u16FilterSample(u8 Copy_u8Index, u16 Copy_u16Sample);
+
+/**
+ * @brief Bring a result of an auto-ranging scan entry to internal reference counts and pick its next range.
+ *
+ * @param Copy_u8Index: Position of the entry in the scan list.
+ * @param Copy_u16Sample: Decimated result, in counts of the range it was taken on.
+ * @return u16: The result in internal reference counts.
+ */
+static u16 ADC_u16AutoRange(u8 Copy_u8Index, u16 Copy_u16Sample);
+
+/**
+ * @brief Derive AVCC from a bandgap result and update the auto-ranging scale.
+ *
+ * @param Copy_u16Bandgap: Oversampled bandgap result taken against AVCC.
+ */
+static void ADC_voidStoreSupply(u16 Copy_u16Bandgap);
+
+/**
+ * @brief Get the reference code (AREF, AVCC or INTERNAL) a scan entry converts with right now.
+ *
+ * @param Copy_u8Index: Position of the entry in the scan list.
+ * @return u8: The reference code.
+ */
+static u8 ADC_u8EntryReference(u8 Copy_u8Index);
+
+/**
+ * @brief Select an ADC reference if it is not selected already.
+ *
+ * @param Copy_u8Reference: The reference code (AREF, AVCC or INTERNAL).
+ * @return u8: Conversions to discard while the new reference settles, 0 if the REFS bits were not changed.
+ */
+static u8 ADC_u8SelectReference(u8 Copy_u8Reference);
+
+/**
+ * @brief Read the result of the conversion that just completed.
+ *
+ * @return u16: The result; a differential result is turned from two's complement into offset binary.
+ */
+static u16 ADC_u16ReadResult(void);
+
+/**
+ * @brief Get the MUX code of a differential input's negative pin against itself, at the same gain.
+ *
+ * @param Copy_u8Channel: MUX code of a differential input.
+ * @return u8: MUX code of the matching zero input.
+ */
+static u8 ADC_u8ZeroChannel(u8 Copy_u8Channel);
+
+/**
+ * @brief Get the MUX code the current scan entry converts next (its input, or its zero input while auto-zeroing).
+ *
+ * @return u8: The MUX code.
+ */
+static u8 ADC_u8ScanEntryChannel(void);
+
+/**
+ * @brief Select the MUX code of the next scan conversion.
+ *
+ * @param Copy_u8Channel: The MUX code.
+ * @return u8: Conversions to discard, ADC_u8GainSettleConversions when switching to a gain input, 0 otherwise.
+ */
+static u8 ADC_u8SelectScanChannel(u8 Copy_u8Channel);
+
+/**
+ * @brief Subtract an auto-zero offset from an oversampled sum, around mid-scale.
+ *
+ * @param Copy_u16Sum: Sum of the entry's conversions, in offset binary.
+ * @param Copy_u16OffsetSum: Sum of the same number of zero input conversions.
+ * @param Copy_u8Oversampling: Oversampling option of the entry.
+ * @return u16: The corrected sum, clamped to the range of the sum.
+ */
+static u16 ADC_u16SubtractOffset(u16 Copy_u16Sum, u16 Copy_u16OffsetSum, u8 Copy_u8Oversampling);
+
+/**
+ * @brief Apply an entry's calibration to one of its filtered results.
+ *
+ * @param Copy_u8Index: Position of the entry in the scan list.
+ * @param Copy_u16Value: Filtered result of the entry.
+ * @return u16: The calibrated result.
+ */
+static u16 ADC_u16Calibrate(u8 Copy_u8Index, u16 Copy_u16Value);
+
+/**
+ * @brief Get the current period of a scan entry, its Period scaled by its adaptive back-off.
+ *
+ * @param Copy_u8Index: Position of the entry in the scan list.
+ * @return u16: The period, in scan slots.
+ */
+static u16 ADC_u16EntryPeriod(u8 Copy_u8Index);
+
+/**
+ * @brief Update the adaptive back-off of a scan entry from its new result.
+ *
+ * @param Copy_u8Index: Position of the entry in the scan list.
+ * @param Copy_u16Value: New result of the entry.
+ */
+static void ADC_voidAdaptPeriod(u8 Copy_u8Index, u16 Copy_u16Value);
+
+/**
+ * @brief Find the next scan entry whose period has elapsed, in round robin order.
+ *
+ * @return u8: Position of the due entry in the scan list, or ADC_SCAN_IDLE_SLOT if none is due.
+ */
+static u8 ADC_u8ScanNextDue(void);
+
+/**
+ * @brief Move every scan period on to the next slot where something is due.
+ *
+ * @return u16: Number of slots skipped, 0 if something is already due.
+ */
+static u16 ADC_u16ScanSkipToNextDue(void);
+
+/**
+ * @brief Compare a filtered scan result with its entry's window and post an event on a zone change.
+ *
+ * @param Copy_u8Index: Position of the entry in the scan list.
+ * @param Copy_u16Value: Filtered result of the entry.
+ */
+static void ADC_voidCheckWindow(u8 Copy_u8Index, u16 Copy_u16Value);
+
 #endif
@@ -12,12 +12,43 @@
 #include "ADC_config.h"
 #include "ADC_interface.h"
 
+/* Bits per conversion for the configured resolution, before oversampling */
+#if ADC_u8Resolution == _8_BIT
+#define ADC_u8ResolutionBits    8u
+#elif ADC_u8Resolution == _10_BIT
+#define ADC_u8ResolutionBits    10u
+#endif
+
+/* Sign bit of a differential (two's complement) result, and mid-scale of the offset binary form */
+#define ADC_u16SignBit          ((u16)1u << (ADC_u8ResolutionBits - 1u))
+
+/* The window event ring and the injected queue are indexed with masked free-running 8-bit counters */
+#if (ADC_u8WindowEventQueueSize < 2u) || (ADC_u8WindowEventQueueSize > 128u) || \
+    ((ADC_u8WindowEventQueueSize & (ADC_u8WindowEventQueueSize - 1u)) != 0u)
+#error "ADC_u8WindowEventQueueSize must be a power of two from 2 to 128"
+#endif
+/* Auto-ranging constants: nominal AVCC counts to internal reference counts (Q8), and the switch points in
+ * internal reference counts at the configured resolution */
+#define ADC_u16NominalAvccRatio ((u16)(((u32)ADC_u16AvccMilliVolts << 8) / ADC_u16InternalMilliVolts))
+#define ADC_u16AutoRangeUp      ((u16)(((u32)ADC_u16AutoRangeUpMilliVolts << ADC_u8ResolutionBits) / ADC_u16InternalMilliVolts))
+#define ADC_u16AutoRangeDown    ((u16)(((u32)ADC_u16AutoRangeDownMilliVolts << ADC_u8ResolutionBits) / ADC_u16InternalMilliVolts))
+
+#if ADC_u8AdaptiveMaxShift > 15u
+#error "ADC_u8AdaptiveMaxShift must be 0 to 15"
+#endif
+
+#if (ADC_u8InjectQueueDepth < 2u) || (ADC_u8InjectQueueDepth > 128u) || \
+    ((ADC_u8InjectQueueDepth & (ADC_u8InjectQueueDepth - 1u)) != 0u)
+#error "ADC_u8InjectQueueDepth must be a power of two from 2 to 128"
+#endif
+
 /* 
  * ADC Driver for an AVR Microcontroller
  * 
  * This driver provides functionalities to configure the ADC, perform both
- * synchronous and asynchronous conversions, and handle multiple channel 
- * (chain) conversions in asynchronous mode using interrupts.
+ * synchronous and asynchronous conversions, handle multiple channel 
+ * (chain) conversions in asynchronous mode using interrupts, and run a
+ * continuous scan over a channel list that re-arms itself from the ISR.
  */
 
 /* Global Variables */
@@ -26,6 +57,75 @@ static u16* ADC_u16Result = NULL;                            // Pointer to store
 static u8 ADC_u8BusyFlag = IDLE;                             // Flag to track ADC's busy/idle status
 static u8 ADC_u8ChainFlag = 0u;                              // Counter for chain conversions (async multi-channel)
 static u8* ADC_ChannelArr = NULL;                            // Pointer to an array of channels for chain conversions
+static u8 ADC_u8ChainIndex = 0u;                             // Index of the channel currently converted in the chain
+static u8 ADC_u8IsrSource = ADC_ISR_SINGLE;                  // Which request the next ADC interrupt belongs to
+
+/* Scan engine state */
+static const ADC_ScanChannel_t* ADC_pstScanChannels = NULL;  // Scan list supplied by the application
+static u8 ADC_u8ScanNumOfChannels = 0u;                      // Number of entries in the scan list
+static u8 ADC_u8ScanCursor = 0u;                             // Scan list entry currently being converted
+static void (*ADC_pvScanNotificationFunc)(void) = NULL;      // Optional end-of-pass callback
+static u16 ADC_u16ScanTable[2][ADC_u8ScanMaxChannels];       // Double-buffered result table
+static volatile u8 ADC_u8ScanFrontBuffer = 0u;               // Index of the buffer holding the last complete pass
+static volatile u8 ADC_u8ScanValid = 0u;                     // Set once the first pass has been published
+static volatile u8 ADC_u8ScanSequence = 0u;                  // Incremented on every published pass (seqlock counter)
+static volatile u8 ADC_u8SleepDone = 0u;                     // Set by the ISR when a noise-reduced conversion completes
+static u16 ADC_u16ScanAccumulator = 0u;                      // Sum of the oversampled conversions of the current entry
+static u8 ADC_u8ScanSampleCount = 0u;                        // Conversions accumulated so far for the current entry
+static u16 ADC_u16ScanDue[ADC_u8ScanMaxChannels];            // Slots left until each entry is due again
+static u8 ADC_u8ScanDirty = 0u;                              // Set when the back buffer holds unpublished results
+static u8 ADC_u8ScanAutoRef[ADC_u8ScanMaxChannels];          // Range currently used by each auto-ranging entry
+static u8 ADC_u8ScanDiscard = 0u;                            // Conversions left to discard while the reference settles
+static u8 ADC_u8ScanBackoff[ADC_u8ScanMaxChannels];          // Adaptive period shift of each entry
+static u8 ADC_u8ScanStable[ADC_u8ScanMaxChannels];           // Stable results in a row of each entry
+static u16 ADC_u16ScanLast[ADC_u8ScanMaxChannels];           // Previous result of each entry
+static u8 ADC_u8ScanZeroPhase = 0u;                          // Set while an auto-zero entry converts its zero input
+static u16 ADC_u16ScanZeroAccumulator = 0u;                  // Sum of the zero input conversions of the current entry
+static volatile u16 ADC_u16ScanParkSlots = 0u;               // Slots left with the trigger un-armed, nothing being due
+
+/* Supply measurement state */
+static u16 ADC_u16SupplyDue = 0u;                            // Slots left until the bandgap is measured again
+static u8 ADC_u8SupplySampleCount = 0u;                      // Bandgap conversions accumulated so far
+static volatile u16 ADC_u16SupplyMilliVolts = 0u;            // Last measured AVCC, 0 until the first measurement
+static u16 ADC_u16AvccRatio = ADC_u16NominalAvccRatio;       // AVCC / internal reference in Q8, from the last measurement
+
+/* ADMUX REFS1:0 bits for each reference code (AREF, AVCC, INTERNAL) */
+static const u8 ADC_u8RefsBits[ADC_REF_AUTO] = {0u, 0b00000000, 0b01000000, 0b11000000};
+
+/* Number of conversions per result for each oversampling option (4^n) */
+static const u8 ADC_u8OversamplingSamples[Oversampling_Max + 1u] = {1u, 4u, 16u, 64u};
+
+/* Per-channel filter state */
+static u16 ADC_u16MedianWindow[ADC_u8ScanMaxChannels][ADC_MEDIAN_5];  // Last raw results of each entry
+static u8 ADC_u8MedianSlot[ADC_u8ScanMaxChannels];                    // Next window slot to overwrite
+static u16 ADC_u16IirState[ADC_u8ScanMaxChannels];                    // Exponential filter state, scaled by 2^FilterShift
+static u8 ADC_u8FilterPrimed = 0u;                                    // Bit per entry, set once its filter is seeded
+
+/* Calibration state */
+static ADC_Calibration_t ADC_stCalibration[ADC_u8ScanMaxChannels];    // Offset and gain of each entry
+static volatile u16 ADC_u16ScanUncalibrated[ADC_u8ScanMaxChannels];   // Last filtered result of each entry, before calibration
+static u8 ADC_u8CalPendingIndex = ADC_CAL_NO_POINT;                   // Entry whose first calibration point is captured
+static u16 ADC_u16CalRaw1 = 0u;                                       // Uncalibrated result at the first point
+static u16 ADC_u16CalKnown1 = 0u;                                     // Known value at the first point
+
+/* Window comparator state */
+static volatile u8 ADC_u8WindowZone[ADC_u8ScanMaxChannels];           // Current zone of each entry
+static ADC_WindowEvent_t ADC_stWindowEvents[ADC_u8WindowEventQueueSize];  // Event ring
+static volatile u8 ADC_u8WindowHead = 0u;                             // Producer index, only written by the ISR
+static volatile u8 ADC_u8WindowTail = 0u;                             // Consumer index, only written by the reader
+
+/* Injected conversion state */
+static ADC_Inject_t ADC_stInjectQueue[ADC_u8InjectQueueDepth];  // Pending high-priority requests
+static volatile u8 ADC_u8InjectHead = 0u;                    // Producer index, only written by the requester
+static volatile u8 ADC_u8InjectTail = 0u;                    // Consumer index, only written by the ISR
+static u8 ADC_u8Injecting = 0u;                              // Set while the conversion in flight is an injected one
+
+/* Burst capture state */
+static u16* ADC_pu16BurstBuffer = NULL;                      // Caller-supplied ring buffer
+static u8 ADC_u8BurstMask = 0u;                              // Ring size - 1 (size is a power of two)
+static volatile u8 ADC_u8BurstHead = 0u;                     // Producer index, only written by the ISR
+static volatile u8 ADC_u8BurstTail = 0u;                     // Consumer index, only written by the reader
+static volatile u16 ADC_u16BurstOverruns = 0u;               // Samples dropped because the ring was full
 
 /*
  * Function: ADC_voidInit
@@ -37,9 +137,12 @@ static u8* ADC_ChannelArr = NULL;                            // Pointer to an ar
  *  - Prescaler division factor
  *
  * The function sets the corresponding bits in the hardware registers such as ADMUX, ADCSRA, and SFIOR.
+ * In auto-trigger mode only the trigger source is selected here; ADATE is set by ADC_u8StartScan.
  * Finally, it enables the ADC by setting the ADEN bit in the ADCSRA register.
  */
 void ADC_voidInit(void) {
+    u8 Local_u8Index;
+
     /* Voltage reference configuration */
 #if ADC_u8Voltage_Ref == AREF
     /* Set AREF as the reference voltage */
@@ -73,8 +176,11 @@ void ADC_voidInit(void) {
     /* Disable auto-trigger mode */
     CLR_BIT(ADCSRA, ADCSRA_ADATE);
 #elif ADC_u8Conv_Mode == Auto_Trigger
-    /* Enable auto-trigger mode */
-    SET_BIT(ADCSRA, ADCSRA_ADATE);
+#if ADC_u8TriggerSource == Free_Running_mode
+#error Free running auto trigger cannot follow a scan list, use Manual conversion mode
+#endif
+    /* Auto-trigger is enabled by the scan engine while it runs */
+    CLR_BIT(ADCSRA, ADCSRA_ADATE);
 
     /* Configure the trigger source */
     SFIOR &= Trigger_Source_Bit_Mask;  // Clear trigger source bits
@@ -89,6 +195,13 @@ void ADC_voidInit(void) {
 
     /* Enable the ADC */
     SET_BIT(ADCSRA, ADCSRA_ADEN);
+
+    /* No entry is calibrated until the application loads its calibration */
+    for (Local_u8Index = 0u; Local_u8Index < ADC_u8ScanMaxChannels; Local_u8Index++) {
+        ADC_stCalibration[Local_u8Index].Offset = 0;
+        ADC_stCalibration[Local_u8Index].Gain = ADC_CAL_GAIN_ONE;
+    }
+    ADC_u8CalPendingIndex = ADC_CAL_NO_POINT;
 }
 
 /*
@@ -117,8 +230,7 @@ u8 ADC_u8StartConversionSynch(u8 Copy_u8Channel, u16* Copy_pu16Result) {
             ADC_u8BusyFlag = BUSY;
 
             /* Set ADC channel */
-            ADMUX &= Channel_Bit_Mask;  // Clear channel bits
-            ADMUX |= Copy_u8Channel;
+            ADC_voidSelectChannel(Copy_u8Channel);
 
             /* Start conversion */
             SET_BIT(ADCSRA, ADCSRA_ADSC);
@@ -136,12 +248,82 @@ u8 ADC_u8StartConversionSynch(u8 Copy_u8Channel, u16* Copy_pu16Result) {
                 SET_BIT(ADCSRA, ADCSRA_ADIF);  // Clear the interrupt flag
 
                 /* Store conversion result */
-#if ADC_u8Resolution == _8_BIT
-                *Copy_pu16Result = ADCH;  // 8-bit result from ADCH
-#elif ADC_u8Resolution == _10_BIT
-                *Copy_pu16Result = ADC;   // 10-bit result from ADC register
-#endif
+                *Copy_pu16Result = ADC_u16ReadResult();
+            }
+
+            /* ADC is now idle */
+            ADC_u8BusyFlag = IDLE;
+        } else {
+            /* ADC is busy */
+            Local_u8ErrState = BUSY_ERR;
+        }
+    } else {
+        /* Null pointer error */
+        Local_u8ErrState = NULL_PTR_ERR;
+    }
+
+    return Local_u8ErrState;
+}
+
+/*
+ * Function: ADC_u8StartConversionSleep
+ * ------------------------------------
+ * Converts the specified channel with the CPU in ADC Noise Reduction sleep.
+ * Entering the sleep mode starts the conversion; the CPU clock is stopped while the ADC converts, and the
+ * ADC interrupt wakes the CPU again. Other interrupt sources that are still clocked (external interrupts,
+ * Timer/Counter2 in asynchronous mode) may wake the CPU early, in which case it goes back to sleep until the
+ * conversion is done.
+ *
+ * Global interrupts are briefly disabled around the flag check so a conversion finishing just before the
+ * SLEEP instruction cannot leave the CPU asleep with nothing to wake it (SEI delays interrupts by one
+ * instruction, so SLEEP always runs first).
+ *
+ * Parameters:
+ *  - Copy_u8Channel: The ADC channel to convert.
+ *  - Copy_pu16Result: Pointer to store the result of the conversion.
+ *
+ * Returns:
+ *  - NO_ERROR if the conversion is successful.
+ *  - BUSY_ERR if the ADC is already busy.
+ *  - NULL_PTR_ERR if the result pointer is NULL.
+ *  - ERROR if global interrupts are disabled (the CPU could never wake up).
+ */
+u8 ADC_u8StartConversionSleep(u8 Copy_u8Channel, u16* Copy_pu16Result) {
+    u8 Local_u8ErrState = NO_ERROR;
+
+    if (Copy_pu16Result != NULL) {
+        if (GET_BIT(SREG, SREG_I) == 0u) {
+            /* Nothing could wake the CPU up */
+            Local_u8ErrState = ERROR;
+        } else if (ADC_u8BusyFlag == IDLE) {
+            /* Mark ADC as busy */
+            ADC_u8BusyFlag = BUSY;
+
+            /* The ISR stores the result and reports completion */
+            ADC_u16Result = Copy_pu16Result;
+            ADC_u8SleepDone = 0u;
+            ADC_u8IsrSource = ADC_ISR_SLEEP;
+
+            /* Set ADC channel */
+            ADC_voidSelectChannel(Copy_u8Channel);
+
+            /* Clear a stale flag and enable ADC interrupt */
+            SET_BIT(ADCSRA, ADCSRA_ADIF);
+            SET_BIT(ADCSRA, ADCSRA_ADIE);
+
+            /* Select ADC Noise Reduction sleep mode */
+            MCUCR &= Sleep_Mode_Bit_Mask;
+            MCUCR |= ADC_Noise_Reduction << Sleep_Mode_Bit_Pos;
+            SET_BIT(MCUCR, MCUCR_SE);
+
+            /* Sleep until the ADC interrupt reports the result, entering sleep starts the conversion */
+            __asm__ __volatile__ ("cli");
+            while (ADC_u8SleepDone == 0u) {
+                __asm__ __volatile__ ("sei" "\n\t" "sleep" "\n\t" "cli");
             }
+            __asm__ __volatile__ ("sei");
+
+            CLR_BIT(MCUCR, MCUCR_SE);
 
             /* ADC is now idle */
             ADC_u8BusyFlag = IDLE;
@@ -184,10 +366,10 @@ u8 ADC_u8StartConversionAsynch(u8 Copy_u8Channel, u16* Copy_pu16Result, void(*Co
             /* Store result and callback globally */
             ADC_u16Result = Copy_pu16Result;
             ADC_pvCallBackNotificationFunc = Copy_pvNotificationFunc;
+            ADC_u8IsrSource = ADC_ISR_SINGLE;
 
             /* Set ADC channel */
-            ADMUX &= Channel_Bit_Mask;  // Clear channel bits
-            ADMUX |= Copy_u8Channel;
+            ADC_voidSelectChannel(Copy_u8Channel);
 
             /* Start conversion */
             SET_BIT(ADCSRA, ADCSRA_ADSC);
@@ -222,21 +404,33 @@ u8 ADC_u8StartConversionAsynch(u8 Copy_u8Channel, u16* Copy_pu16Result, void(*Co
  *  - NO_ERROR if the chain conversion is started successfully.
  *  - BUSY_ERR if the ADC is already busy.
  *  - NULL_PTR_ERR if any pointer is NULL.
+ *  - ERROR if the number of channels is 0.
  */
 u8 ADC_u8StartChainConvAsynch(u8 Copy_u8NumOfChannels, u8* Copy_u8Channels, u16* Copy_pu16Results, void(*Copy_pvNotificationFunc)(void)) {
     u8 Local_u8ErrState = NO_ERROR;
 
     if ((Copy_pu16Results != NULL) && (Copy_pvNotificationFunc != NULL) && (Copy_u8Channels != NULL)) {
-        if (ADC_u8BusyFlag == IDLE) {
+        if (Copy_u8NumOfChannels == 0u) {
+            /* Nothing to convert */
+            Local_u8ErrState = ERROR;
+        } else if (ADC_u8BusyFlag == IDLE) {
             /* Mark ADC as busy */
             ADC_u8BusyFlag = BUSY;
 
             /* Store chain information globally */
             ADC_u8ChainFlag = Copy_u8NumOfChannels;
             ADC_ChannelArr = Copy_u8Channels;
+            ADC_u8ChainIndex = 0u;
+            ADC_u16Result = Copy_pu16Results;
+            ADC_pvCallBackNotificationFunc = Copy_pvNotificationFunc;
+            ADC_u8IsrSource = ADC_ISR_CHAIN;
 
             /* Start the first conversion */
-            ADC_u8StartConversionAsynch(*Copy_u8Channels, Copy_pu16Results, Copy_pvNotificationFunc);
+            ADC_voidSelectChannel(Copy_u8Channels[0]);
+            SET_BIT(ADCSRA, ADCSRA_ADSC);
+
+            /* Enable ADC interrupt */
+            SET_BIT(ADCSRA, ADCSRA_ADIE);
         } else {
             /* ADC is busy */
             Local_u8ErrState = BUSY_ERR;
@@ -250,35 +444,1631 @@ u8 ADC_u8StartChainConvAsynch(u8 Copy_u8NumOfChannels, u8* Copy_u8Channels, u16*
 }
 
 /*
- * Interrupt Service Routine (ISR) for ADC conversion complete
- * -----------------------------------------------------------
- * This ISR is triggered when an ADC conversion completes.
- * It stores the conversion result and starts the next conversion in a chain if needed.
- * When all conversions are complete, the callback function is invoked.
+ * Function: ADC_u8StartScan
+ * -------------------------
+ * Starts the continuous scan engine over a list of channels.
+ * The first conversion is started here (or by the first trigger event in auto-trigger mode); from then on
+ * the ISR moves a cursor over the due entries of the list, stores each result in the back half of a
+ * double-buffered table and re-arms the ADC on the next due entry.
+ * When a pass ends, the back buffer becomes the front buffer and is copied forward into the new back buffer,
+ * so readers always see a complete table.
+ *
+ * Parameters:
+ *  - Copy_u8NumOfChannels: Number of entries in the scan list (1 .. ADC_u8ScanMaxChannels).
+ *  - Copy_pstChannels: Scan list. It is not copied, so it must stay valid while the scan runs.
+ *  - Copy_pvNotificationFunc: Optional callback invoked from the ISR after every complete pass (may be NULL).
+ *
+ * Returns:
+ *  - NO_ERROR if the scan is started successfully.
+ *  - BUSY_ERR if the ADC is already busy.
+ *  - NULL_PTR_ERR if the scan list is NULL.
+ *  - ERROR if the number of channels or an entry's oversampling or filter option is out of range,
+ *    or an entry's window is empty.
  */
-void __vector_16(void) __attribute__((signal));
-void __vector_16(void) {
-    /* Store conversion result */
-#if ADC_u8Resolution == _8_BIT
-    *ADC_u16Result = ADCH;  // 8-bit result from ADCH
-#elif ADC_u8Resolution == _10_BIT
-    *ADC_u16Result = ADC;   // 10-bit result from ADC register
+u8 ADC_u8StartScan(u8 Copy_u8NumOfChannels, const ADC_ScanChannel_t* Copy_pstChannels, void(*Copy_pvNotificationFunc)(void)) {
+    u8 Local_u8ErrState = NO_ERROR;
+
+    u8 Local_u8Index;
+    u8 Local_u8Settle;
+
+    if (Copy_pstChannels != NULL) {
+        if ((Copy_u8NumOfChannels == 0u) || (Copy_u8NumOfChannels > ADC_u8ScanMaxChannels)) {
+            /* Scan list does not fit the result table */
+            Local_u8ErrState = ERROR;
+        } else {
+            /* Validate the per-channel options */
+            for (Local_u8Index = 0u; Local_u8Index < Copy_u8NumOfChannels; Local_u8Index++) {
+                if ((Copy_pstChannels[Local_u8Index].Channel > ADC_CH_GND) ||
+                    (Copy_pstChannels[Local_u8Index].Oversampling > Oversampling_Max)) {
+                    Local_u8ErrState = ERROR;
+                } else if ((Copy_pstChannels[Local_u8Index].Median != ADC_MEDIAN_OFF) &&
+                           (Copy_pstChannels[Local_u8Index].Median != ADC_MEDIAN_3) &&
+                           (Copy_pstChannels[Local_u8Index].Median != ADC_MEDIAN_5)) {
+                    Local_u8ErrState = ERROR;
+                } else if ((ADC_u8ResolutionBits + Copy_pstChannels[Local_u8Index].Oversampling +
+                            Copy_pstChannels[Local_u8Index].FilterShift) > 16u) {
+                    /* The scaled exponential filter state would not fit in 16 bits */
+                    Local_u8ErrState = ERROR;
+                } else if (Copy_pstChannels[Local_u8Index].WindowLow > Copy_pstChannels[Local_u8Index].WindowHigh) {
+                    /* Empty window */
+                    Local_u8ErrState = ERROR;
+                } else if (Copy_pstChannels[Local_u8Index].Reference > ADC_REF_AUTO) {
+                    Local_u8ErrState = ERROR;
+                } else if ((Copy_pstChannels[Local_u8Index].Reference == ADC_REF_AUTO) &&
+                           ((ADC_u8ResolutionBits + Copy_pstChannels[Local_u8Index].Oversampling +
+                             Copy_pstChannels[Local_u8Index].FilterShift + 1u) > 16u)) {
+                    /* Auto-ranged results span one more bit (AVCC range in internal reference counts) */
+                    Local_u8ErrState = ERROR;
+                } else if ((Copy_pstChannels[Local_u8Index].Channel >= ADC_FIRST_DIFF_CHANNEL) &&
+                           (Copy_pstChannels[Local_u8Index].Channel <= ADC_LAST_DIFF_CHANNEL)) {
+                    if (Copy_pstChannels[Local_u8Index].Reference == ADC_REF_AUTO) {
+                        /* Rescaling would move the mid-scale zero of a differential result */
+                        Local_u8ErrState = ERROR;
+                    }
+                } else if (Copy_pstChannels[Local_u8Index].AutoZero != 0u) {
+                    /* Only a differential input has a zero input to subtract */
+                    Local_u8ErrState = ERROR;
+                }
+            }
+        }
+
+        if (Local_u8ErrState != NO_ERROR) {
+            /* Invalid scan list, error already set */
+        } else if (ADC_u8BusyFlag == IDLE) {
+            /* Mark ADC as busy */
+            ADC_u8BusyFlag = BUSY;
+
+            /* Store scan information globally */
+            ADC_pstScanChannels = Copy_pstChannels;
+            ADC_u8ScanNumOfChannels = Copy_u8NumOfChannels;
+            ADC_pvScanNotificationFunc = Copy_pvNotificationFunc;
+            ADC_u8ScanCursor = 0u;
+            ADC_u8ScanValid = 0u;
+            ADC_u8ScanDirty = 0u;
+            ADC_u16ScanParkSlots = 0u;
+            ADC_u16SupplyDue = 0u;  // Measure the supply early
+            ADC_u8SupplySampleCount = 0u;
+            ADC_u16ScanAccumulator = 0u;
+            ADC_u8ScanSampleCount = 0u;
+            ADC_u16ScanZeroAccumulator = 0u;
+            ADC_u8ScanZeroPhase = (Copy_pstChannels[0].AutoZero != 0u) ? 1u : 0u;
+            ADC_u8FilterPrimed = 0u;
+            for (Local_u8Index = 0u; Local_u8Index < Copy_u8NumOfChannels; Local_u8Index++) {
+                ADC_u8MedianSlot[Local_u8Index] = 0u;
+                ADC_u8WindowZone[Local_u8Index] = ADC_ZONE_UNKNOWN;
+                ADC_u16ScanDue[Local_u8Index] = 0u;
+                ADC_u8ScanBackoff[Local_u8Index] = 0u;   // Start at the fastest rate
+                ADC_u8ScanStable[Local_u8Index] = 0u;
+                ADC_u16ScanLast[Local_u8Index] = 0u;
+                ADC_u8ScanAutoRef[Local_u8Index] = ADC_REF_AVCC;  // Start on the range that cannot clip
+            }
+            /* Every entry is due at the start, so the first pass converts them all in order */
+            ADC_u16ScanDue[0] = ADC_u16EntryPeriod(0u);
+            ADC_u8WindowHead = 0u;
+            ADC_u8WindowTail = 0u;
+            ADC_u8IsrSource = ADC_ISR_SCAN;
+
+            /* Select the first channel, the ISR keeps the scan running */
+            ADC_u8ScanDiscard = ADC_u8SelectScanChannel(ADC_u8ScanEntryChannel());
+            Local_u8Settle = ADC_u8SelectReference(ADC_u8EntryReference(0u));
+            if (ADC_u8ScanDiscard < Local_u8Settle) {
+                ADC_u8ScanDiscard = Local_u8Settle;
+            }
+#if ADC_u8Conv_Mode == Manual
+            SET_BIT(ADCSRA, ADCSRA_ADSC);
+#elif ADC_u8Conv_Mode == Auto_Trigger
+            /* Conversions start on the trigger source from now on */
+            SET_BIT(ADCSRA, ADCSRA_ADATE);
 #endif
 
-    /* Chain conversion handling */
-    ADC_u8ChainFlag--;
-    if (ADC_u8ChainFlag > 0) {
-        /* Start next conversion in the chain */
-        ADC_u8StartConversionAsynch(ADC_ChannelArr[1], ADC_u16Result + 1, ADC_pvCallBackNotificationFunc);
+            /* Enable ADC interrupt */
+            SET_BIT(ADCSRA, ADCSRA_ADIE);
+        } else {
+            /* ADC is busy */
+            Local_u8ErrState = BUSY_ERR;
+        }
     } else {
-        /* All conversions complete, invoke the callback */
-        ADC_pvCallBackNotificationFunc();
+        /* Null pointer error */
+        Local_u8ErrState = NULL_PTR_ERR;
+    }
+
+    return Local_u8ErrState;
+}
+
+/*
+ * Function: ADC_voidStopScan
+ * --------------------------
+ * Stops the scan engine and releases the ADC.
+ * The conversion in flight (if any) is allowed to finish and its flag is cleared, so the next synchronous
+ * conversion does not pick up a stale result. The last published pass stays readable.
+ */
+void ADC_voidStopScan(void) {
+    u8 Local_u8Sreg;
+
+    if ((ADC_u8BusyFlag == BUSY) && (ADC_u8IsrSource == ADC_ISR_SCAN)) {
+        /* Un-park first so that ADC_voidScanTick cannot re-arm the trigger (the 16-bit count is cleared
+         * with interrupts off, the tick runs from an interrupt) */
+        Local_u8Sreg = SREG;
+        __asm__ __volatile__ ("cli" ::: "memory");
+        ADC_u16ScanParkSlots = 0u;
+        SREG = Local_u8Sreg;
+
+        /* Stop the ISR and the trigger source from re-arming the ADC */
+        CLR_BIT(ADCSRA, ADCSRA_ADIE);
+        CLR_BIT(ADCSRA, ADCSRA_ADATE);
+
+        /* Let the current conversion finish, then discard it */
+        while (GET_BIT(ADCSRA, ADCSRA_ADSC) == 1u);
+        SET_BIT(ADCSRA, ADCSRA_ADIF);
+
+        /* Drop injected requests that have not completed */
+        ADC_u8Injecting = 0u;
+        ADC_u8InjectTail = ADC_u8InjectHead;
+
+        /* Give the other requests the configured reference back */
+        ADC_u8SelectReference(ADC_u8Voltage_Ref);
 
         /* ADC is now idle */
         ADC_u8BusyFlag = IDLE;
+    }
+}
 
-        /* Disable ADC interrupt */
-        CLR_BIT(ADCSRA, ADCSRA_ADIE);
+/*
+ * Function: ADC_u8InjectConversion
+ * --------------------------------
+ * Requests a high-priority conversion. While a scan is running the request is queued and the ISR runs it
+ * right after the conversion in flight, ahead of the remaining scan entries; the scan then resumes where it
+ * was. When the ADC is idle the request starts at once as an asynchronous conversion.
+ *
+ * The queue is written only by this function and read only by the ISR, so it must be called from the
+ * main loop, not from another ISR.
+ *
+ * Parameters:
+ *  - Copy_u8Channel: The ADC channel to convert.
+ *  - Copy_pu16Result: Pointer to store the result of the conversion.
+ *  - Copy_pvNotificationFunc: Callback function to call when the conversion completes.
+ *
+ * Returns:
+ *  - NO_ERROR if the request is queued or started.
+ *  - BUSY_ERR if the queue is full, or the ADC is busy with a request other than a scan.
+ *  - NULL_PTR_ERR if any pointer is NULL.
+ */
+u8 ADC_u8InjectConversion(u8 Copy_u8Channel, u16* Copy_pu16Result, void(*Copy_pvNotificationFunc)(void)) {
+    u8 Local_u8ErrState = NO_ERROR;
+    u8 Local_u8Head;
+
+    if ((Copy_pu16Result != NULL) && (Copy_pvNotificationFunc != NULL)) {
+        if (ADC_u8BusyFlag == IDLE) {
+            /* Nothing to preempt */
+            Local_u8ErrState = ADC_u8StartConversionAsynch(Copy_u8Channel, Copy_pu16Result, Copy_pvNotificationFunc);
+        } else if (ADC_u8IsrSource != ADC_ISR_SCAN) {
+            /* Only a scan can be preempted */
+            Local_u8ErrState = BUSY_ERR;
+        } else {
+            Local_u8Head = ADC_u8InjectHead;
+            if ((u8)(Local_u8Head - ADC_u8InjectTail) < ADC_u8InjectQueueDepth) {
+                /* Fill the slot before publishing it to the ISR */
+                ADC_stInjectQueue[Local_u8Head & (ADC_u8InjectQueueDepth - 1u)].Channel = Copy_u8Channel;
+                ADC_stInjectQueue[Local_u8Head & (ADC_u8InjectQueueDepth - 1u)].Result = Copy_pu16Result;
+                ADC_stInjectQueue[Local_u8Head & (ADC_u8InjectQueueDepth - 1u)].NotificationFunc = Copy_pvNotificationFunc;
+                ADC_MEMORY_BARRIER();
+                ADC_u8InjectHead = Local_u8Head + 1u;
+#if ADC_u8Conv_Mode == Auto_Trigger
+                /* Between two trigger events the ADC may be waiting for the next one, which could be a whole
+                 * tick away. Pause the trigger and, if no conversion is in flight or waiting in the ISR,
+                 * start the injected request now.
+                 * ADIF is cleared by writing 1, so it is written as 0 here to keep a pending interrupt. */
+                ADCSRA &= (u8)(~((1u << ADCSRA_ADIE) | (1u << ADCSRA_ADATE) | (1u << ADCSRA_ADIF)));
+                if ((GET_BIT(ADCSRA, ADCSRA_ADSC) == 0u) && (GET_BIT(ADCSRA, ADCSRA_ADIF) == 0u)) {
+                    ADC_u8Injecting = 1u;
+                    ADC_voidSelectChannel(ADC_stInjectQueue[ADC_u8InjectTail & (ADC_u8InjectQueueDepth - 1u)].Channel);
+                    ADCSRA = (ADCSRA & (u8)(~(1u << ADCSRA_ADIF))) | (1u << ADCSRA_ADSC);
+                }
+                ADCSRA = (ADCSRA & (u8)(~(1u << ADCSRA_ADIF))) | (1u << ADCSRA_ADIE);
+#endif
+            } else {
+                /* Queue is full */
+                Local_u8ErrState = BUSY_ERR;
+            }
+        }
+    } else {
+        /* Null pointer error */
+        Local_u8ErrState = NULL_PTR_ERR;
+    }
+
+    return Local_u8ErrState;
+}
+
+/*
+ * Function: ADC_u8GetScanResult
+ * -----------------------------
+ * Reads one entry of the last complete scan pass.
+ *
+ * Parameters:
+ *  - Copy_u8Index: Position of the channel in the scan list.
+ *  - Copy_pu16Result: Pointer to store the result.
+ *
+ * Returns:
+ *  - NO_ERROR if the result is returned.
+ *  - NULL_PTR_ERR if the result pointer is NULL.
+ *  - ERROR if the index is out of range or no pass has completed yet.
+ */
+u8 ADC_u8GetScanResult(u8 Copy_u8Index, u16* Copy_pu16Result) {
+    u8 Local_u8ErrState = NO_ERROR;
+    u8 Local_u8Sequence;
+
+    if (Copy_pu16Result != NULL) {
+        if ((Copy_u8Index < ADC_u8ScanNumOfChannels) && (ADC_u8ScanValid == 1u)) {
+            /* Retry if a pass was published while the 16-bit value was being read */
+            do {
+                Local_u8Sequence = ADC_u8ScanSequence;
+                ADC_MEMORY_BARRIER();
+                *Copy_pu16Result = ADC_u16ScanTable[ADC_u8ScanFrontBuffer][Copy_u8Index];
+                ADC_MEMORY_BARRIER();
+            } while (Local_u8Sequence != ADC_u8ScanSequence);
+        } else {
+            Local_u8ErrState = ERROR;
+        }
+    } else {
+        /* Null pointer error */
+        Local_u8ErrState = NULL_PTR_ERR;
+    }
+
+    return Local_u8ErrState;
+}
+
+/*
+ * Function: ADC_u8GetScanSnapshot
+ * -------------------------------
+ * Copies every entry of the last complete scan pass as one consistent set.
+ *
+ * The ISR only ever writes the back buffer, and the front buffer only changes when a pass is published,
+ * which also increments ADC_u8ScanSequence. So if the sequence is the same before and after the copy,
+ * no entry of the copied buffer was written during the copy. Otherwise the copy is retried.
+ * Interrupts are never disabled, and a pass takes far longer than a copy, so one retry is the practical
+ * worst case.
+ *
+ * Parameters:
+ *  - Copy_pu16Results: Array of at least the scan list length to receive the results.
+ *  - Copy_pu8Sequence: Optional pointer to receive the pass sequence number (may be NULL).
+ *
+ * Returns:
+ *  - NO_ERROR if the snapshot is copied.
+ *  - NULL_PTR_ERR if the result array is NULL.
+ *  - ERROR if no pass has completed yet.
+ */
+u8 ADC_u8GetScanSnapshot(u16* Copy_pu16Results, u8* Copy_pu8Sequence) {
+    u8 Local_u8ErrState = NO_ERROR;
+    u8 Local_u8Sequence;
+    u8 Local_u8Index;
+    const u16* Local_pu16Front;
+
+    if (Copy_pu16Results != NULL) {
+        if (ADC_u8ScanValid == 1u) {
+            do {
+                Local_u8Sequence = ADC_u8ScanSequence;
+                ADC_MEMORY_BARRIER();
+                Local_pu16Front = ADC_u16ScanTable[ADC_u8ScanFrontBuffer];
+                for (Local_u8Index = 0u; Local_u8Index < ADC_u8ScanNumOfChannels; Local_u8Index++) {
+                    Copy_pu16Results[Local_u8Index] = Local_pu16Front[Local_u8Index];
+                }
+                ADC_MEMORY_BARRIER();
+            } while (Local_u8Sequence != ADC_u8ScanSequence);
+
+            if (Copy_pu8Sequence != NULL) {
+                *Copy_pu8Sequence = Local_u8Sequence;
+            }
+        } else {
+            Local_u8ErrState = ERROR;
+        }
+    } else {
+        /* Null pointer error */
+        Local_u8ErrState = NULL_PTR_ERR;
+    }
+
+    return Local_u8ErrState;
+}
+
+/*
+ * Function: ADC_u8GetWindowEvent
+ * ------------------------------
+ * Takes the oldest window event out of the event ring.
+ * The ring works like the burst ring: the ISR only moves the head and the reader only moves the tail.
+ *
+ * Parameters:
+ *  - Copy_pstEvent: Pointer to store the event.
+ *
+ * Returns:
+ *  - NO_ERROR if an event is returned.
+ *  - NULL_PTR_ERR if the event pointer is NULL.
+ *  - ERROR if no event is pending.
+ */
+u8 ADC_u8GetWindowEvent(ADC_WindowEvent_t* Copy_pstEvent) {
+    u8 Local_u8ErrState = NO_ERROR;
+    u8 Local_u8Tail;
+
+    if (Copy_pstEvent != NULL) {
+        Local_u8Tail = ADC_u8WindowTail;
+        if (Local_u8Tail != ADC_u8WindowHead) {
+            /* Copy the event before releasing its slot to the ISR */
+            ADC_MEMORY_BARRIER();
+            *Copy_pstEvent = ADC_stWindowEvents[Local_u8Tail & (ADC_u8WindowEventQueueSize - 1u)];
+            ADC_MEMORY_BARRIER();
+            ADC_u8WindowTail = Local_u8Tail + 1u;
+        } else {
+            /* No event pending */
+            Local_u8ErrState = ERROR;
+        }
+    } else {
+        /* Null pointer error */
+        Local_u8ErrState = NULL_PTR_ERR;
+    }
+
+    return Local_u8ErrState;
+}
+
+/*
+ * Function: ADC_u8GetWindowZone
+ * -----------------------------
+ * Reads the current window zone of a scan entry.
+ *
+ * Parameters:
+ *  - Copy_u8Index: Position of the entry in the scan list.
+ *  - Copy_pu8Zone: Pointer to store the zone.
+ *
+ * Returns:
+ *  - NO_ERROR if the zone is returned.
+ *  - NULL_PTR_ERR if the zone pointer is NULL.
+ *  - ERROR if the index is out of range, the entry has no window or no result yet.
+ */
+u8 ADC_u8GetWindowZone(u8 Copy_u8Index, u8* Copy_pu8Zone) {
+    u8 Local_u8ErrState = NO_ERROR;
+    u8 Local_u8Zone;
+
+    if (Copy_pu8Zone != NULL) {
+        if (Copy_u8Index >= ADC_u8ScanNumOfChannels) {
+            Local_u8ErrState = ERROR;
+        } else {
+            Local_u8Zone = ADC_u8WindowZone[Copy_u8Index];
+            if (Local_u8Zone == ADC_ZONE_UNKNOWN) {
+                /* No window, or no result yet */
+                Local_u8ErrState = ERROR;
+            } else {
+                *Copy_pu8Zone = Local_u8Zone;
+            }
+        }
+    } else {
+        /* Null pointer error */
+        Local_u8ErrState = NULL_PTR_ERR;
+    }
+
+    return Local_u8ErrState;
+}
+
+/*
+ * Function: ADC_u8GetScanReference
+ * --------------------------------
+ * Reads the reference a scan entry currently converts with.
+ *
+ * Parameters:
+ *  - Copy_u8Index: Position of the entry in the scan list.
+ *  - Copy_pu8Reference: Pointer to store the reference (ADC_REF_AREF, ADC_REF_AVCC or ADC_REF_INTERNAL).
+ *
+ * Returns:
+ *  - NO_ERROR if the reference is returned.
+ *  - NULL_PTR_ERR if the reference pointer is NULL.
+ *  - ERROR if the index is out of range.
+ */
+u8 ADC_u8GetScanReference(u8 Copy_u8Index, u8* Copy_pu8Reference) {
+    u8 Local_u8ErrState = NO_ERROR;
+
+    if (Copy_pu8Reference != NULL) {
+        if (Copy_u8Index < ADC_u8ScanNumOfChannels) {
+            *Copy_pu8Reference = ADC_u8EntryReference(Copy_u8Index);
+        } else {
+            Local_u8ErrState = ERROR;
+        }
+    } else {
+        /* Null pointer error */
+        Local_u8ErrState = NULL_PTR_ERR;
     }
+
+    return Local_u8ErrState;
 }
 
+/*
+ * Function: ADC_u8GetSupplyMilliVolts
+ * -----------------------------------
+ * Reads the AVCC voltage last measured by the scan through the bandgap channel.
+ * The 16-bit value is read until two reads agree, so an ISR update between the two bytes is not torn.
+ *
+ * Parameters:
+ *  - Copy_pu16MilliVolts: Pointer to store the supply voltage, in millivolts.
+ *
+ * Returns:
+ *  - NO_ERROR if the voltage is returned.
+ *  - NULL_PTR_ERR if the pointer is NULL.
+ *  - ERROR if the supply has not been measured yet.
+ */
+u8 ADC_u8GetSupplyMilliVolts(u16* Copy_pu16MilliVolts) {
+    u8 Local_u8ErrState = NO_ERROR;
+    u16 Local_u16MilliVolts;
+
+    if (Copy_pu16MilliVolts != NULL) {
+        do {
+            Local_u16MilliVolts = ADC_u16SupplyMilliVolts;
+        } while (Local_u16MilliVolts != ADC_u16SupplyMilliVolts);
+
+        if (Local_u16MilliVolts != 0u) {
+            *Copy_pu16MilliVolts = Local_u16MilliVolts;
+        } else {
+            /* No measurement yet */
+            Local_u8ErrState = ERROR;
+        }
+    } else {
+        /* Null pointer error */
+        Local_u8ErrState = NULL_PTR_ERR;
+    }
+
+    return Local_u8ErrState;
+}
+
+/*
+ * Function: ADC_u8GetDifferentialChannel
+ * --------------------------------------
+ * Resolves a differential input to its MUX code, following the ATmega32 MUX table:
+ *  - 10x and 200x: 0x08 + 2 * Negative + (2 for 200x) + (Positive - Negative), for Negative 0 or 2 and
+ *    Positive equal to Negative or one above it.
+ *  - 1x: 0x10 + Positive against ADC1, 0x18 + Positive against ADC2 (Positive up to ADC5).
+ *
+ * Parameters:
+ *  - Copy_pstDifferential: Pointer to the differential input.
+ *  - Copy_pu8Channel: Pointer to store the MUX code.
+ *
+ * Returns:
+ *  - NO_ERROR if the MUX code is returned.
+ *  - NULL_PTR_ERR if any pointer is NULL.
+ *  - ERROR if the ATmega32 has no such pair at that gain.
+ */
+u8 ADC_u8GetDifferentialChannel(const ADC_Differential_t* Copy_pstDifferential, u8* Copy_pu8Channel) {
+    u8 Local_u8ErrState = NO_ERROR;
+    u8 Local_u8Positive;
+    u8 Local_u8Negative;
+
+    if ((Copy_pstDifferential != NULL) && (Copy_pu8Channel != NULL)) {
+        Local_u8Positive = Copy_pstDifferential->Positive;
+        Local_u8Negative = Copy_pstDifferential->Negative;
+
+        if ((Local_u8Positive > ADC_DIFF_MAX_PIN) || (Local_u8Negative > ADC_DIFF_MAX_PIN)) {
+            Local_u8ErrState = ERROR;
+        } else if ((Copy_pstDifferential->Gain == ADC_GAIN_X10) || (Copy_pstDifferential->Gain == ADC_GAIN_X200)) {
+            if (((Local_u8Negative == 0u) || (Local_u8Negative == 2u)) &&
+                ((Local_u8Positive == Local_u8Negative) || (Local_u8Positive == (Local_u8Negative + 1u)))) {
+                *Copy_pu8Channel = ADC_FIRST_DIFF_CHANNEL + (Local_u8Negative << 1) + (Local_u8Positive - Local_u8Negative);
+                if (Copy_pstDifferential->Gain == ADC_GAIN_X200) {
+                    *Copy_pu8Channel += 2u;
+                }
+            } else {
+                /* No gain stage on that pair */
+                Local_u8ErrState = ERROR;
+            }
+        } else if (Copy_pstDifferential->Gain == ADC_GAIN_X1) {
+            if (Local_u8Negative == 1u) {
+                *Copy_pu8Channel = ADC_FIRST_NEG1_X1_CHANNEL + Local_u8Positive;
+            } else if ((Local_u8Negative == 2u) &&
+                       (Local_u8Positive <= (ADC_LAST_DIFF_CHANNEL - ADC_FIRST_NEG2_X1_CHANNEL))) {
+                *Copy_pu8Channel = ADC_FIRST_NEG2_X1_CHANNEL + Local_u8Positive;
+            } else {
+                /* No such pair */
+                Local_u8ErrState = ERROR;
+            }
+        } else {
+            /* Invalid gain option */
+            Local_u8ErrState = ERROR;
+        }
+    } else {
+        /* Null pointer error */
+        Local_u8ErrState = NULL_PTR_ERR;
+    }
+
+    return Local_u8ErrState;
+}
+
+/*
+ * Function: ADC_s16GetSignedResult
+ * --------------------------------
+ * Turns an offset binary differential result back into a signed value by subtracting mid-scale,
+ * 2^(bits - 1) shifted left by the oversampling option.
+ *
+ * Parameters:
+ *  - Copy_u16Result: The offset binary result.
+ *  - Copy_u8Oversampling: Oversampling option the result was taken with.
+ *
+ * Returns:
+ *  - The signed result.
+ */
+s16 ADC_s16GetSignedResult(u16 Copy_u16Result, u8 Copy_u8Oversampling) {
+    return (s16)((s32)Copy_u16Result - ((s32)ADC_u16SignBit << Copy_u8Oversampling));
+}
+
+/*
+ * Function: ADC_u8SetCalibration
+ * ------------------------------
+ * Sets the offset and gain applied to a scan entry's results. The ISR reads the calibration, so it is
+ * written with global interrupts disabled (for a few cycles) and never seen half updated.
+ *
+ * Parameters:
+ *  - Copy_u8Index: Position of the entry in the scan list.
+ *  - Copy_pstCalibration: Pointer to the calibration.
+ *
+ * Returns:
+ *  - NO_ERROR if the calibration is set.
+ *  - NULL_PTR_ERR if the calibration pointer is NULL.
+ *  - ERROR if the index is out of range or the gain is 0.
+ */
+u8 ADC_u8SetCalibration(u8 Copy_u8Index, const ADC_Calibration_t* Copy_pstCalibration) {
+    u8 Local_u8ErrState = NO_ERROR;
+    u8 Local_u8Sreg;
+
+    if (Copy_pstCalibration != NULL) {
+        if ((Copy_u8Index < ADC_u8ScanMaxChannels) && (Copy_pstCalibration->Gain != 0u)) {
+            /* The ISR reads the calibration: copy it with interrupts off, and keep the copy inside that
+             * section with memory clobbers on both ends */
+            Local_u8Sreg = SREG;
+            __asm__ __volatile__ ("cli" ::: "memory");
+            ADC_stCalibration[Copy_u8Index] = *Copy_pstCalibration;
+            ADC_MEMORY_BARRIER();
+            SREG = Local_u8Sreg;
+        } else {
+            Local_u8ErrState = ERROR;
+        }
+    } else {
+        /* Null pointer error */
+        Local_u8ErrState = NULL_PTR_ERR;
+    }
+
+    return Local_u8ErrState;
+}
+
+/*
+ * Function: ADC_u8GetCalibration
+ * ------------------------------
+ * Reads the offset and gain of a scan entry. Only the main loop writes them, so no locking is needed.
+ *
+ * Parameters:
+ *  - Copy_u8Index: Position of the entry in the scan list.
+ *  - Copy_pstCalibration: Pointer to store the calibration.
+ *
+ * Returns:
+ *  - NO_ERROR if the calibration is returned.
+ *  - NULL_PTR_ERR if the calibration pointer is NULL.
+ *  - ERROR if the index is out of range.
+ */
+u8 ADC_u8GetCalibration(u8 Copy_u8Index, ADC_Calibration_t* Copy_pstCalibration) {
+    u8 Local_u8ErrState = NO_ERROR;
+
+    if (Copy_pstCalibration != NULL) {
+        if (Copy_u8Index < ADC_u8ScanMaxChannels) {
+            *Copy_pstCalibration = ADC_stCalibration[Copy_u8Index];
+        } else {
+            Local_u8ErrState = ERROR;
+        }
+    } else {
+        /* Null pointer error */
+        Local_u8ErrState = NULL_PTR_ERR;
+    }
+
+    return Local_u8ErrState;
+}
+
+/*
+ * Function: ADC_u8CalibratePoint
+ * ------------------------------
+ * Pairs the entry's current uncalibrated result with a known value. With the first pair (r1, k1) and the
+ * second (r2, k2), the calibration y = ((x - Offset) * Gain) >> 14 that maps r1 to k1 and r2 to k2 is:
+ *    Gain = ((k2 - k1) << 14) / (r2 - r1)
+ *    Offset = r1 - (k1 << 14) / Gain
+ * both rounded to nearest, in 32-bit integers. Everything stays in the main loop; the ISR only ever sees
+ * the finished calibration.
+ *
+ * Parameters:
+ *  - Copy_u8Index: Position of the entry in the scan list.
+ *  - Copy_u8Point: ADC_CAL_POINT_1 or ADC_CAL_POINT_2.
+ *  - Copy_u16Known: The true value of the input, in result units.
+ *
+ * Returns:
+ *  - NO_ERROR if the point is captured (and, for the second point, the calibration applied).
+ *  - ERROR if the entry has no result, the point is invalid or out of order, or the calibration is unusable.
+ */
+u8 ADC_u8CalibratePoint(u8 Copy_u8Index, u8 Copy_u8Point, u16 Copy_u16Known) {
+    u8 Local_u8ErrState = NO_ERROR;
+    u16 Local_u16Raw;
+    s32 Local_s32RawSpan;
+    s32 Local_s32KnownSpan;
+    s32 Local_s32Gain = 0;
+    s32 Local_s32Offset = 0;
+    ADC_Calibration_t Local_stCalibration;
+
+    if ((Copy_u8Index < ADC_u8ScanNumOfChannels) && (GET_BIT(ADC_u8FilterPrimed, Copy_u8Index) == 1u)) {
+        /* Read until two reads agree, so an ISR update between the two bytes is not torn */
+        do {
+            Local_u16Raw = ADC_u16ScanUncalibrated[Copy_u8Index];
+        } while (Local_u16Raw != ADC_u16ScanUncalibrated[Copy_u8Index]);
+
+        if (Copy_u8Point == ADC_CAL_POINT_1) {
+            ADC_u8CalPendingIndex = Copy_u8Index;
+            ADC_u16CalRaw1 = Local_u16Raw;
+            ADC_u16CalKnown1 = Copy_u16Known;
+        } else if ((Copy_u8Point == ADC_CAL_POINT_2) && (ADC_u8CalPendingIndex == Copy_u8Index)) {
+            Local_s32RawSpan = (s32)Local_u16Raw - (s32)ADC_u16CalRaw1;
+            Local_s32KnownSpan = (s32)Copy_u16Known - (s32)ADC_u16CalKnown1;
+            if (Local_s32RawSpan < 0) {
+                /* Same gain with both spans positive */
+                Local_s32RawSpan = -Local_s32RawSpan;
+                Local_s32KnownSpan = -Local_s32KnownSpan;
+            }
+
+            if (Local_s32RawSpan != 0) {
+                Local_s32Gain = ((Local_s32KnownSpan * (s32)ADC_CAL_GAIN_ONE) + (Local_s32RawSpan >> 1)) / Local_s32RawSpan;
+            }
+            if ((Local_s32Gain > 0) && (Local_s32Gain <= 0xFFFF)) {
+                Local_s32Offset = (s32)ADC_u16CalRaw1 -
+                                  ((((s32)ADC_u16CalKnown1 * (s32)ADC_CAL_GAIN_ONE) + (Local_s32Gain >> 1)) / Local_s32Gain);
+            }
+
+            if ((Local_s32Gain <= 0) || (Local_s32Gain > 0xFFFF) || (Local_s32Offset < -32768) || (Local_s32Offset > 32767)) {
+                /* Same result at both points, inverted or too large a gain */
+                Local_u8ErrState = ERROR;
+            } else {
+                Local_stCalibration.Offset = (s16)Local_s32Offset;
+                Local_stCalibration.Gain = (u16)Local_s32Gain;
+                Local_u8ErrState = ADC_u8SetCalibration(Copy_u8Index, &Local_stCalibration);
+                ADC_u8CalPendingIndex = ADC_CAL_NO_POINT;
+            }
+        } else {
+            /* Invalid point, or point 2 without point 1 */
+            Local_u8ErrState = ERROR;
+        }
+    } else {
+        /* Not a running entry, or no result yet */
+        Local_u8ErrState = ERROR;
+    }
+
+    return Local_u8ErrState;
+}
+
+/*
+ * Function: ADC_u8StartBurst
+ * --------------------------
+ * Starts a burst capture: the ADC runs in free running mode on one channel and every result is pushed
+ * from the ISR into a caller-supplied ring buffer. The reader drains it with ADC_u8ReadBurstSample while
+ * the capture goes on.
+ *
+ * The ring uses free-running 8-bit producer and consumer indices masked by the buffer size. Each index is
+ * written by one side only and a u8 access is atomic, so neither side has to disable interrupts. The
+ * difference of the two indices is the fill level, which is why the size is limited to 128 samples.
+ *
+ * The burst clock uses ADC_u8BurstPrescalerDivisionFactor; the configured prescaler and trigger source
+ * are restored by ADC_voidStopBurst.
+ *
+ * Parameters:
+ *  - Copy_u8Channel: The ADC channel to capture.
+ *  - Copy_pu16Buffer: Ring buffer. It must stay valid until the burst is stopped and drained.
+ *  - Copy_u8BufferSize: Number of samples in the ring, a power of two from 2 to 128.
+ *
+ * Returns:
+ *  - NO_ERROR if the burst is started successfully.
+ *  - BUSY_ERR if the ADC is already busy.
+ *  - NULL_PTR_ERR if the buffer pointer is NULL.
+ *  - ERROR if the buffer size is not a power of two between 2 and 128.
+ */
+u8 ADC_u8StartBurst(u8 Copy_u8Channel, u16* Copy_pu16Buffer, u8 Copy_u8BufferSize) {
+    u8 Local_u8ErrState = NO_ERROR;
+
+    if (Copy_pu16Buffer != NULL) {
+        if ((Copy_u8BufferSize < 2u) || (Copy_u8BufferSize > Burst_Max_Size) ||
+            ((Copy_u8BufferSize & (u8)(Copy_u8BufferSize - 1u)) != 0u)) {
+            /* Not a power of two the indices can handle */
+            Local_u8ErrState = ERROR;
+        } else if (ADC_u8BusyFlag == IDLE) {
+            /* Mark ADC as busy */
+            ADC_u8BusyFlag = BUSY;
+
+            /* Store ring information globally */
+            ADC_pu16BurstBuffer = Copy_pu16Buffer;
+            ADC_u8BurstMask = Copy_u8BufferSize - 1u;
+            ADC_u8BurstHead = 0u;
+            ADC_u8BurstTail = 0u;
+            ADC_u16BurstOverruns = 0u;
+            ADC_u8IsrSource = ADC_ISR_BURST;
+
+            /* Set ADC channel */
+            ADC_voidSelectChannel(Copy_u8Channel);
+
+            /* Free running trigger and burst prescaler */
+            SFIOR &= Trigger_Source_Bit_Mask;
+            SFIOR |= Free_Running_mode << Trigger_Source_Bit_Pos;
+            ADCSRA &= Prescaler_Bit_Mask;
+            ADCSRA |= ADC_u8BurstPrescalerDivisionFactor << Prescaler_Bit_Pos;
+
+            /* Clear a stale flag, enable ADC interrupt and start the first conversion */
+            SET_BIT(ADCSRA, ADCSRA_ADIF);
+            SET_BIT(ADCSRA, ADCSRA_ADATE);
+            SET_BIT(ADCSRA, ADCSRA_ADIE);
+            SET_BIT(ADCSRA, ADCSRA_ADSC);
+        } else {
+            /* ADC is busy */
+            Local_u8ErrState = BUSY_ERR;
+        }
+    } else {
+        /* Null pointer error */
+        Local_u8ErrState = NULL_PTR_ERR;
+    }
+
+    return Local_u8ErrState;
+}
+
+/*
+ * Function: ADC_voidStopBurst
+ * ---------------------------
+ * Stops a burst capture after the conversion in flight, restores the configured prescaler and trigger
+ * source and releases the ADC. Samples still in the ring can be drained afterwards.
+ */
+void ADC_voidStopBurst(void) {
+    if ((ADC_u8BusyFlag == BUSY) && (ADC_u8IsrSource == ADC_ISR_BURST)) {
+        /* Stop free running and the ISR */
+        CLR_BIT(ADCSRA, ADCSRA_ADATE);
+        CLR_BIT(ADCSRA, ADCSRA_ADIE);
+
+        /* Let the current conversion finish, then discard it */
+        while (GET_BIT(ADCSRA, ADCSRA_ADSC) == 1u);
+        SET_BIT(ADCSRA, ADCSRA_ADIF);
+
+        /* Restore the configured prescaler and trigger source */
+        ADCSRA &= Prescaler_Bit_Mask;
+        ADCSRA |= ADC_u8PrescalerDivisionFactor << Prescaler_Bit_Pos;
+#if ADC_u8Conv_Mode == Auto_Trigger
+        SFIOR &= Trigger_Source_Bit_Mask;
+        SFIOR |= ADC_u8TriggerSource << Trigger_Source_Bit_Pos;
+#endif
+
+        /* ADC is now idle */
+        ADC_u8BusyFlag = IDLE;
+    }
+}
+
+/*
+ * Function: ADC_u8ReadBurstSample
+ * -------------------------------
+ * Takes the oldest sample out of the burst ring buffer.
+ *
+ * Parameters:
+ *  - Copy_pu16Sample: Pointer to store the sample.
+ *
+ * Returns:
+ *  - NO_ERROR if a sample is returned.
+ *  - NULL_PTR_ERR if the sample pointer is NULL.
+ *  - ERROR if the ring is empty.
+ */
+u8 ADC_u8ReadBurstSample(u16* Copy_pu16Sample) {
+    u8 Local_u8ErrState = NO_ERROR;
+    u8 Local_u8Tail;
+
+    if (Copy_pu16Sample != NULL) {
+        Local_u8Tail = ADC_u8BurstTail;
+        if (Local_u8Tail != ADC_u8BurstHead) {
+            /* Copy the sample before releasing its slot to the producer */
+            ADC_MEMORY_BARRIER();
+            *Copy_pu16Sample = ADC_pu16BurstBuffer[Local_u8Tail & ADC_u8BurstMask];
+            ADC_MEMORY_BARRIER();
+            ADC_u8BurstTail = Local_u8Tail + 1u;
+        } else {
+            /* Ring is empty */
+            Local_u8ErrState = ERROR;
+        }
+    } else {
+        /* Null pointer error */
+        Local_u8ErrState = NULL_PTR_ERR;
+    }
+
+    return Local_u8ErrState;
+}
+
+/*
+ * Function: ADC_u16GetBurstOverruns
+ * ---------------------------------
+ * Returns how many samples were dropped because the ring was full since the burst was started.
+ * The 16-bit counter is read until two reads agree, so an ISR update between the two bytes is not torn.
+ */
+u16 ADC_u16GetBurstOverruns(void) {
+    u16 Local_u16Overruns;
+
+    do {
+        Local_u16Overruns = ADC_u16BurstOverruns;
+    } while (Local_u16Overruns != ADC_u16BurstOverruns);
+
+    return Local_u16Overruns;
+}
+
+/*
+ * Function: ADC_u16FilterSample
+ * -----------------------------
+ * Runs one decimated result of a scan entry through the entry's filter pipeline:
+ *  1. Median of the last 3 or 5 results, which removes single-sample spikes.
+ *  2. Exponential filter y += (x - y) / 2^FilterShift, kept as a state scaled by 2^FilterShift so no
+ *     fractional bits are lost: S = S - (S >> k) + x, y = S >> k.
+ * The first result of an entry seeds the median window and the filter state, so the output starts at
+ * the input instead of ramping up from zero.
+ *
+ * Everything is integer with a fixed number of steps: at most 7 compare-exchanges for the median and
+ * two shifts by at most 7 bits for the exponential filter.
+ *
+ * Parameters:
+ *  - Copy_u8Index: Position of the entry in the scan list.
+ *  - Copy_u16Sample: Decimated result of the entry.
+ *
+ * Returns:
+ *  - The filtered result.
+ */
+static u16 ADC_u16FilterSample(u8 Copy_u8Index, u16 Copy_u16Sample) {
+    const ADC_ScanChannel_t* Local_pstEntry = &ADC_pstScanChannels[Copy_u8Index];
+    u16* Local_pu16Window = ADC_u16MedianWindow[Copy_u8Index];
+    u16 Local_u16A, Local_u16B, Local_u16C, Local_u16D, Local_u16E;
+    u8 Local_u8Slot;
+
+    if (GET_BIT(ADC_u8FilterPrimed, Copy_u8Index) == 0u) {
+        /* Seed the filter with the first result */
+        for (Local_u8Slot = 0u; Local_u8Slot < ADC_MEDIAN_5; Local_u8Slot++) {
+            Local_pu16Window[Local_u8Slot] = Copy_u16Sample;
+        }
+        ADC_u16IirState[Copy_u8Index] = Copy_u16Sample << Local_pstEntry->FilterShift;
+        SET_BIT(ADC_u8FilterPrimed, Copy_u8Index);
+    }
+
+    /* Median stage */
+    if (Local_pstEntry->Median != ADC_MEDIAN_OFF) {
+        Local_u8Slot = ADC_u8MedianSlot[Copy_u8Index];
+        Local_pu16Window[Local_u8Slot] = Copy_u16Sample;
+        Local_u8Slot++;
+        if (Local_u8Slot == Local_pstEntry->Median) {
+            Local_u8Slot = 0u;
+        }
+        ADC_u8MedianSlot[Copy_u8Index] = Local_u8Slot;
+
+        Local_u16A = Local_pu16Window[0];
+        Local_u16B = Local_pu16Window[1];
+        Local_u16C = Local_pu16Window[2];
+        if (Local_pstEntry->Median == ADC_MEDIAN_3) {
+            ADC_CSWAP(Local_u16A, Local_u16B);
+            ADC_CSWAP(Local_u16B, Local_u16C);
+            ADC_CSWAP(Local_u16A, Local_u16B);
+            Copy_u16Sample = Local_u16B;
+        } else {
+            Local_u16D = Local_pu16Window[3];
+            Local_u16E = Local_pu16Window[4];
+            ADC_CSWAP(Local_u16A, Local_u16B);
+            ADC_CSWAP(Local_u16D, Local_u16E);
+            ADC_CSWAP(Local_u16A, Local_u16D);
+            ADC_CSWAP(Local_u16B, Local_u16E);
+            ADC_CSWAP(Local_u16B, Local_u16C);
+            ADC_CSWAP(Local_u16C, Local_u16D);
+            ADC_CSWAP(Local_u16B, Local_u16C);
+            Copy_u16Sample = Local_u16C;
+        }
+    }
+
+    /* Exponential filter stage */
+    if (Local_pstEntry->FilterShift != 0u) {
+        ADC_u16IirState[Copy_u8Index] = ADC_u16IirState[Copy_u8Index] - (ADC_u16IirState[Copy_u8Index] >> Local_pstEntry->FilterShift) + Copy_u16Sample;
+        Copy_u16Sample = ADC_u16IirState[Copy_u8Index] >> Local_pstEntry->FilterShift;
+    }
+
+    return Copy_u16Sample;
+}
+
+/*
+ * Function: ADC_u16Calibrate
+ * --------------------------
+ * Applies y = ((x - Offset) * Gain) >> 14 to a filtered result, clamped to 0 .. 65535: one 16x16 to 32-bit
+ * multiply and a shift, no division. Uncalibrated entries return the result unchanged.
+ */
+static u16 ADC_u16Calibrate(u8 Copy_u8Index, u16 Copy_u16Value) {
+    const ADC_Calibration_t* Local_pstCalibration = &ADC_stCalibration[Copy_u8Index];
+    s32 Local_s32Value;
+    u32 Local_u32Scaled;
+    u16 Local_u16Result = Copy_u16Value;
+
+    if ((Local_pstCalibration->Offset != 0) || (Local_pstCalibration->Gain != ADC_CAL_GAIN_ONE)) {
+        Local_s32Value = (s32)Copy_u16Value - Local_pstCalibration->Offset;
+        if (Local_s32Value <= 0) {
+            Local_u16Result = 0u;
+        } else {
+            Local_u32Scaled = ((u32)Local_s32Value * Local_pstCalibration->Gain) >> ADC_CAL_GAIN_SHIFT;
+            if (Local_u32Scaled > 0xFFFFu) {
+                Local_u16Result = 0xFFFFu;
+            } else {
+                Local_u16Result = (u16)Local_u32Scaled;
+            }
+        }
+    }
+
+    return Local_u16Result;
+}
+
+/*
+ * Function: ADC_u16EntryPeriod
+ * ----------------------------
+ * Returns Period << back-off, with a Period of 0 counted as 1 so that it can back off too, saturated
+ * at 65535 slots.
+ */
+static u16 ADC_u16EntryPeriod(u8 Copy_u8Index) {
+    u32 Local_u32Period = ADC_pstScanChannels[Copy_u8Index].Period;
+
+    if (Local_u32Period == 0u) {
+        Local_u32Period = 1u;
+    }
+    Local_u32Period <<= ADC_u8ScanBackoff[Copy_u8Index];
+    if (Local_u32Period > 0xFFFFu) {
+        Local_u32Period = 0xFFFFu;
+    }
+
+    return (u16)Local_u32Period;
+}
+
+/*
+ * Function: ADC_voidAdaptPeriod
+ * -----------------------------
+ * Compares a new result with the entry's previous one:
+ *  - A step larger than ADC_u16AdaptiveDelta (scaled by 2^Oversampling) clears the back-off, and the entry
+ *    is due again after Period slots at most, instead of the longer period it was started with.
+ *  - Otherwise, every ADC_u8AdaptiveStableResults stable results double the period, up to
+ *    Period << ADC_u8AdaptiveMaxShift.
+ * The previous result starts at 0 when the scan starts, so the first result normally counts as a step.
+ * The cost is a subtraction and a few compares per result.
+ */
+static void ADC_voidAdaptPeriod(u8 Copy_u8Index, u16 Copy_u16Value) {
+    u16 Local_u16Step;
+    u16 Local_u16Delta = (u16)(ADC_u16AdaptiveDelta << ADC_pstScanChannels[Copy_u8Index].Oversampling);
+
+    if (Copy_u16Value >= ADC_u16ScanLast[Copy_u8Index]) {
+        Local_u16Step = Copy_u16Value - ADC_u16ScanLast[Copy_u8Index];
+    } else {
+        Local_u16Step = ADC_u16ScanLast[Copy_u8Index] - Copy_u16Value;
+    }
+    ADC_u16ScanLast[Copy_u8Index] = Copy_u16Value;
+
+    if (Local_u16Step > Local_u16Delta) {
+        /* The input is changing: back to the fastest rate at once */
+        ADC_u8ScanBackoff[Copy_u8Index] = 0u;
+        ADC_u8ScanStable[Copy_u8Index] = 0u;
+        if (ADC_u16ScanDue[Copy_u8Index] > ADC_u16EntryPeriod(Copy_u8Index)) {
+            ADC_u16ScanDue[Copy_u8Index] = ADC_u16EntryPeriod(Copy_u8Index);
+        }
+    } else if (ADC_u8ScanBackoff[Copy_u8Index] < ADC_u8AdaptiveMaxShift) {
+        ADC_u8ScanStable[Copy_u8Index]++;
+        if (ADC_u8ScanStable[Copy_u8Index] >= ADC_u8AdaptiveStableResults) {
+            ADC_u8ScanBackoff[Copy_u8Index]++;
+            ADC_u8ScanStable[Copy_u8Index] = 0u;
+        }
+    }
+}
+
+/*
+ * Function: ADC_u8ScanNextDue
+ * ---------------------------
+ * Looks for the next scan entry whose period has elapsed, in round robin order starting after the entry
+ * converted last, so a fast entry cannot starve the others.
+ *
+ * Returns:
+ *  - The position of the due entry in the scan list.
+ *  - ADC_SCAN_IDLE_SLOT if no entry is due.
+ */
+static u8 ADC_u8ScanNextDue(void) {
+    u8 Local_u8Index = ADC_u8ScanCursor;
+    u8 Local_u8Due = ADC_SCAN_IDLE_SLOT;
+    u8 Local_u8Count;
+
+    for (Local_u8Count = 0u; (Local_u8Count < ADC_u8ScanNumOfChannels) && (Local_u8Due == ADC_SCAN_IDLE_SLOT); Local_u8Count++) {
+        Local_u8Index++;
+        if (Local_u8Index == ADC_u8ScanNumOfChannels) {
+            Local_u8Index = 0u;
+        }
+        if (ADC_u16ScanDue[Local_u8Index] == 0u) {
+            Local_u8Due = Local_u8Index;
+        }
+    }
+
+    return Local_u8Due;
+}
+
+/*
+ * Function: ADC_u16ScanSkipToNextDue
+ * ----------------------------------
+ * Finds the fewest slots until an entry (or the supply measurement) is due, and counts them off every
+ * period at once, as that many idle slots would have. Nothing changes if something is already due.
+ *
+ * Returns:
+ *  - The number of slots skipped.
+ */
+static u16 ADC_u16ScanSkipToNextDue(void) {
+    u16 Local_u16Skip = 0xFFFFu;
+    u8 Local_u8Index;
+
+    for (Local_u8Index = 0u; Local_u8Index < ADC_u8ScanNumOfChannels; Local_u8Index++) {
+        if (ADC_u16ScanDue[Local_u8Index] < Local_u16Skip) {
+            Local_u16Skip = ADC_u16ScanDue[Local_u8Index];
+        }
+    }
+#if ADC_u16SupplyPeriod != 0u
+    if (ADC_u16SupplyDue < Local_u16Skip) {
+        Local_u16Skip = ADC_u16SupplyDue;
+    }
+    ADC_u16SupplyDue -= Local_u16Skip;
+#endif
+    for (Local_u8Index = 0u; Local_u8Index < ADC_u8ScanNumOfChannels; Local_u8Index++) {
+        ADC_u16ScanDue[Local_u8Index] -= Local_u16Skip;
+    }
+
+    return Local_u16Skip;
+}
+
+/*
+ * Function: ADC_voidScanTick
+ * --------------------------
+ * Counts one trigger period while the scan is parked. On the slot before the next due one, the trigger
+ * is armed again, so the due entry converts on the next trigger event as if the idle slots had run.
+ * An injected conversion in flight re-arms the trigger itself when it completes.
+ */
+void ADC_voidScanTick(void) {
+#if (ADC_u8Conv_Mode == Auto_Trigger) && (ADC_u8ScanSkipIdleSlots == 1u)
+    if (ADC_u16ScanParkSlots != 0u) {
+        ADC_u16ScanParkSlots--;
+        if ((ADC_u16ScanParkSlots == 0u) && (ADC_u8Injecting == 0u)) {
+            SET_BIT(ADCSRA, ADCSRA_ADATE);
+        }
+    }
+#endif
+}
+
+/*
+ * Function: ADC_voidCheckWindow
+ * -----------------------------
+ * Compares a filtered scan result with its entry's window. The zone only changes once the result is past
+ * a threshold by more than the hysteresis, and an event is posted only when it changes, so a steady or
+ * slowly drifting input costs two compares per result and no events.
+ * The comparisons are done in 32 bits so thresholds near 0 or 0xFFFF do not wrap.
+ *
+ * Parameters:
+ *  - Copy_u8Index: Position of the entry in the scan list.
+ *  - Copy_u16Value: Filtered result of the entry.
+ */
+static void ADC_voidCheckWindow(u8 Copy_u8Index, u16 Copy_u16Value) {
+    const ADC_ScanChannel_t* Local_pstEntry = &ADC_pstScanChannels[Copy_u8Index];
+    u8 Local_u8Zone = ADC_u8WindowZone[Copy_u8Index];
+    u8 Local_u8NewZone;
+    u8 Local_u8Head;
+
+    /* Entries with WindowLow = WindowHigh = 0 have no window */
+    if ((Local_pstEntry->WindowLow != 0u) || (Local_pstEntry->WindowHigh != 0u)) {
+        if (Local_u8Zone == ADC_ZONE_UNKNOWN) {
+            /* First result: plain comparison, no hysteresis */
+            if (Copy_u16Value < Local_pstEntry->WindowLow) {
+                Local_u8NewZone = ADC_ZONE_BELOW;
+            } else if (Copy_u16Value > Local_pstEntry->WindowHigh) {
+                Local_u8NewZone = ADC_ZONE_ABOVE;
+            } else {
+                Local_u8NewZone = ADC_ZONE_INSIDE;
+            }
+        } else if (((u32)Copy_u16Value + Local_pstEntry->Hysteresis) < Local_pstEntry->WindowLow) {
+            Local_u8NewZone = ADC_ZONE_BELOW;
+        } else if ((u32)Copy_u16Value > ((u32)Local_pstEntry->WindowHigh + Local_pstEntry->Hysteresis)) {
+            Local_u8NewZone = ADC_ZONE_ABOVE;
+        } else if ((Local_u8Zone == ADC_ZONE_BELOW) &&
+                   ((u32)Copy_u16Value > ((u32)Local_pstEntry->WindowLow + Local_pstEntry->Hysteresis))) {
+            Local_u8NewZone = ADC_ZONE_INSIDE;
+        } else if ((Local_u8Zone == ADC_ZONE_ABOVE) &&
+                   (((u32)Copy_u16Value + Local_pstEntry->Hysteresis) < Local_pstEntry->WindowHigh)) {
+            Local_u8NewZone = ADC_ZONE_INSIDE;
+        } else {
+            /* Inside the hysteresis band, keep the zone */
+            Local_u8NewZone = Local_u8Zone;
+        }
+
+        if (Local_u8NewZone != Local_u8Zone) {
+            ADC_u8WindowZone[Copy_u8Index] = Local_u8NewZone;
+
+            /* Post the event, or drop it if the reader fell behind */
+            Local_u8Head = ADC_u8WindowHead;
+            if ((u8)(Local_u8Head - ADC_u8WindowTail) < ADC_u8WindowEventQueueSize) {
+                ADC_stWindowEvents[Local_u8Head & (ADC_u8WindowEventQueueSize - 1u)].Entry = Copy_u8Index;
+                ADC_stWindowEvents[Local_u8Head & (ADC_u8WindowEventQueueSize - 1u)].Zone = Local_u8NewZone;
+                ADC_stWindowEvents[Local_u8Head & (ADC_u8WindowEventQueueSize - 1u)].Value = Copy_u16Value;
+                ADC_MEMORY_BARRIER();
+                ADC_u8WindowHead = Local_u8Head + 1u;
+            }
+        }
+    }
+}
+
+/*
+ * Function: ADC_u16AutoRange
+ * --------------------------
+ * Brings a result of an auto-ranging entry to internal reference counts and picks the range of its next
+ * result. A result taken on AVCC is scaled by AVCC / 2.56 V, using the measured AVCC once the supply has
+ * been sampled, so both ranges share one scale and the filter
+ * and window of the entry do not see a step when the range changes. The entry moves to AVCC above
+ * ADC_u16AutoRangeUpMilliVolts and back to the internal reference below ADC_u16AutoRangeDownMilliVolts.
+ *
+ * Parameters:
+ *  - Copy_u8Index: Position of the entry in the scan list.
+ *  - Copy_u16Sample: Decimated result of the entry, in counts of the range it was taken on.
+ *
+ * Returns:
+ *  - The result in internal reference counts.
+ */
+static u16 ADC_u16AutoRange(u8 Copy_u8Index, u16 Copy_u16Sample) {
+    u8 Local_u8Oversampling = ADC_pstScanChannels[Copy_u8Index].Oversampling;
+
+    if (ADC_u8ScanAutoRef[Copy_u8Index] == ADC_REF_AVCC) {
+        Copy_u16Sample = (u16)(((u32)Copy_u16Sample * ADC_u16AvccRatio) >> 8);
+        if (Copy_u16Sample < (u16)(ADC_u16AutoRangeDown << Local_u8Oversampling)) {
+            ADC_u8ScanAutoRef[Copy_u8Index] = ADC_REF_INTERNAL;
+        }
+    } else if (Copy_u16Sample > (u16)(ADC_u16AutoRangeUp << Local_u8Oversampling)) {
+        ADC_u8ScanAutoRef[Copy_u8Index] = ADC_REF_AVCC;
+    }
+
+    return Copy_u16Sample;
+}
+
+/*
+ * Function: ADC_voidStoreSupply
+ * -----------------------------
+ * Derives AVCC from a bandgap conversion taken against AVCC: the result is VBG * 2^bits / AVCC, so
+ * AVCC = VBG * 2^bits / result. It also updates the scale used for AVCC results of auto-ranging entries.
+ * The two divisions run once per supply measurement, not per conversion.
+ *
+ * Parameters:
+ *  - Copy_u16Bandgap: Oversampled bandgap result, with ADC_SUPPLY_OVERSAMPLING extra bits.
+ */
+static void ADC_voidStoreSupply(u16 Copy_u16Bandgap) {
+    u16 Local_u16MilliVolts;
+
+    if (Copy_u16Bandgap != 0u) {
+        Local_u16MilliVolts = (u16)(((u32)ADC_u16BandgapMilliVolts << (ADC_u8ResolutionBits + ADC_SUPPLY_OVERSAMPLING)) / Copy_u16Bandgap);
+        ADC_u16SupplyMilliVolts = Local_u16MilliVolts;
+        ADC_u16AvccRatio = (u16)(((u32)Local_u16MilliVolts << 8) / ADC_u16InternalMilliVolts);
+    }
+}
+
+/*
+ * Function: ADC_u8EntryReference
+ * ------------------------------
+ * Returns the reference code (AREF, AVCC or INTERNAL) a scan entry converts with right now.
+ */
+static u8 ADC_u8EntryReference(u8 Copy_u8Index) {
+    u8 Local_u8Reference = ADC_pstScanChannels[Copy_u8Index].Reference;
+
+    if (Local_u8Reference == ADC_REF_DEFAULT) {
+        Local_u8Reference = ADC_u8Voltage_Ref;
+    } else if (Local_u8Reference == ADC_REF_AUTO) {
+        Local_u8Reference = ADC_u8ScanAutoRef[Copy_u8Index];
+    }
+
+    return Local_u8Reference;
+}
+
+/*
+ * Function: ADC_u8SelectReference
+ * -------------------------------
+ * Writes the REFS bits of ADMUX if they differ from the requested reference.
+ * AVCC and an external AREF drive the AREF pin directly, so they settle within a few conversions; the internal
+ * reference charges the AREF capacitor through its 32 kOhm output and needs many more.
+ *
+ * Returns:
+ *  - The number of conversions to discard while the new reference settles, 0 if it was already selected.
+ */
+static u8 ADC_u8SelectReference(u8 Copy_u8Reference) {
+    u8 Local_u8Settle = 0u;
+
+    if ((ADMUX & (u8)(~Reference_Bit_Mask)) != ADC_u8RefsBits[Copy_u8Reference]) {
+        ADMUX &= Reference_Bit_Mask;
+        ADMUX |= ADC_u8RefsBits[Copy_u8Reference];
+        Local_u8Settle = (Copy_u8Reference == ADC_REF_INTERNAL) ? ADC_u8RefSettleConversions : ADC_u8DirectRefSettleConversions;
+    }
+
+    return Local_u8Settle;
+}
+
+/*
+ * Function: ADC_u16ReadResult
+ * ---------------------------
+ * Reads the result of the conversion that just completed. ADMUX still selects the channel of that conversion,
+ * since the MUX bits are only changed once the result has been read. A differential result is two's complement
+ * with its sign in the top bit (bit 9 of ADC, or bit 7 of ADCH when left adjusted); flipping that bit gives
+ * offset binary, which the unsigned accumulators, filters and windows handle without any other change.
+ */
+static u16 ADC_u16ReadResult(void) {
+    u16 Local_u16Result;
+    u8 Local_u8Channel = ADMUX & (u8)(~Channel_Bit_Mask);
+
+#if ADC_u8Resolution == _8_BIT
+    Local_u16Result = ADCH;  // 8-bit result from ADCH
+#elif ADC_u8Resolution == _10_BIT
+    Local_u16Result = ADC;   // 10-bit result from ADC register
+#endif
+
+    if ((Local_u8Channel >= ADC_FIRST_DIFF_CHANNEL) && (Local_u8Channel <= ADC_LAST_DIFF_CHANNEL)) {
+        Local_u16Result ^= ADC_u16SignBit;
+    }
+
+    return Local_u16Result;
+}
+
+/*
+ * Function: ADC_u8ZeroChannel
+ * ---------------------------
+ * Returns the MUX code of a differential input's negative pin against itself at the same gain, which reads the
+ * offset of the input stage only. The 10x and 200x codes come in (N - N, P - N) pairs, so the zero input is
+ * the even code of the pair; the 1x inputs share ADC1 - ADC1 or ADC2 - ADC2.
+ */
+static u8 ADC_u8ZeroChannel(u8 Copy_u8Channel) {
+    u8 Local_u8Zero;
+
+    if (Copy_u8Channel <= ADC_LAST_GAIN_CHANNEL) {
+        Local_u8Zero = Copy_u8Channel & 0xFEu;
+    } else if (Copy_u8Channel < ADC_FIRST_NEG2_X1_CHANNEL) {
+        Local_u8Zero = ADC_X1_NEG1_ZERO_CHANNEL;
+    } else {
+        Local_u8Zero = ADC_X1_NEG2_ZERO_CHANNEL;
+    }
+
+    return Local_u8Zero;
+}
+
+/*
+ * Function: ADC_u8ScanEntryChannel
+ * --------------------------------
+ * Returns the MUX code the current scan entry converts next: its zero input during the auto-zero phase,
+ * its own input otherwise.
+ */
+static u8 ADC_u8ScanEntryChannel(void) {
+    u8 Local_u8Channel = ADC_pstScanChannels[ADC_u8ScanCursor].Channel;
+
+    if (ADC_u8ScanZeroPhase == 1u) {
+        Local_u8Channel = ADC_u8ZeroChannel(Local_u8Channel);
+    }
+
+    return Local_u8Channel;
+}
+
+/*
+ * Function: ADC_u8SelectScanChannel
+ * ---------------------------------
+ * Selects the MUX code of the next scan conversion. The first conversion after switching to a 10x or 200x
+ * input is inaccurate while the offset cancellation of the gain stage settles, so ADC_u8GainSettleConversions
+ * is returned in that case; staying on the same gain input costs nothing.
+ */
+static u8 ADC_u8SelectScanChannel(u8 Copy_u8Channel) {
+    u8 Local_u8Discard = 0u;
+
+    if ((Copy_u8Channel >= ADC_FIRST_DIFF_CHANNEL) && (Copy_u8Channel <= ADC_LAST_GAIN_CHANNEL) &&
+        ((ADMUX & (u8)(~Channel_Bit_Mask)) != Copy_u8Channel)) {
+        Local_u8Discard = ADC_u8GainSettleConversions;
+    }
+    ADC_voidSelectChannel(Copy_u8Channel);
+
+    return Local_u8Discard;
+}
+
+/*
+ * Function: ADC_u16SubtractOffset
+ * -------------------------------
+ * Subtracts the summed zero input conversions from the summed entry conversions. Both sums are offset binary
+ * over 4^n conversions, so 4^n times mid-scale is added back, and the difference is clamped to the range of
+ * such a sum, 0 .. 2^(bits + 2n) - 1.
+ */
+static u16 ADC_u16SubtractOffset(u16 Copy_u16Sum, u16 Copy_u16OffsetSum, u8 Copy_u8Oversampling) {
+    s32 Local_s32Sum;
+    s32 Local_s32Max = ((s32)1 << (ADC_u8ResolutionBits + (Copy_u8Oversampling << 1))) - 1;
+
+    Local_s32Sum = (s32)Copy_u16Sum - (s32)Copy_u16OffsetSum + ((s32)ADC_u16SignBit << (Copy_u8Oversampling << 1));
+    if (Local_s32Sum < 0) {
+        Local_s32Sum = 0;
+    } else if (Local_s32Sum > Local_s32Max) {
+        Local_s32Sum = Local_s32Max;
+    }
+
+    return (u16)Local_s32Sum;
+}
+
+/*
+ * Function: ADC_voidSelectChannel
+ * -------------------------------
+ * Writes the channel (MUX) bits of ADMUX, leaving the reference and adjustment bits untouched.
+ */
+static void ADC_voidSelectChannel(u8 Copy_u8Channel) {
+    ADMUX &= Channel_Bit_Mask;  // Clear channel bits
+    ADMUX |= (Copy_u8Channel & (u8)(~Channel_Bit_Mask));
+}
+
+/*
+ * Interrupt Service Routine (ISR) for ADC conversion complete
+ * -----------------------------------------------------------
+ * This ISR is triggered when an ADC conversion completes.
+ * It stores the conversion result and, depending on the request that started the conversion:
+ *  - Single: invokes the callback and releases the ADC.
+ *  - Chain: starts the next channel of the chain, or invokes the callback after the last one.
+ *  - Sleep: stores the result and tells ADC_u8StartConversionSleep the conversion is done.
+ *  - Burst: pushes the result into the burst ring buffer; the ADC is free running, so nothing is re-armed.
+ *  - Scan: counts down every entry's period, accumulates the oversampled conversions of the current entry, filters
+ *    and calibrates the decimated result, checks it against the entry's window (posting an event on a zone change), stores it,
+ *    re-arms the ADC on the next due entry and publishes the pass when the round robin wraps. When none is due,
+ *    either the periods are moved on to the next due slot and the trigger stays un-armed until ADC_voidScanTick
+ *    has counted the skipped slots (ADC_u8ScanSkipIdleSlots), or an idle conversion runs and is discarded.
+ *    When the next entry needs another reference, the REFS bits are switched and the following conversions
+ *    are discarded while the reference settles: ADC_u8RefSettleConversions for the internal reference,
+ *    ADC_u8DirectRefSettleConversions for AVCC or AREF, less the slots the trigger stays parked.
+ *    Every ADC_u16SupplyPeriod slots the bandgap is converted against AVCC between two entries, to measure the supply.
+ *    An auto-zero entry converts its zero input 4^n times before its own input, and the offset sum is subtracted
+ *    before decimation. Switching to a 10x or 200x input discards ADC_u8GainSettleConversions conversions.
+ *    Each result also updates its entry's adaptive period, which applies from the entry's next start.
+ *    Oversampling adds a bounded cost: one 16-bit add and compare per conversion, plus a right shift
+ *    by at most Oversampling_Max bits once per result.
+ *    In auto-trigger mode re-arming only selects the channel; the trigger source starts the conversion.
+ *    If injected requests are queued, they are converted first, back to back and started with ADSC (the
+ *    auto trigger is paused meanwhile), and the scan resumes on the same entry once the queue is empty.
+ *    An injected request therefore waits at most for the conversion in flight plus the injected requests
+ *    queued before it.
+ */
+void __vector_16(void) __attribute__((signal));
+void __vector_16(void) {
+    u16 Local_u16Result;
+    u8 Local_u8PassDone = 0u;
+    u8 Local_u8SelectNext = 0u;
+    u8 Local_u8Oversampling;
+    u8 Local_u8Index;
+    u8 Local_u8Discard;
+    u8 Local_u8Settle;
+    const ADC_Inject_t* Local_pstInject;
+    void (*Local_pvInjectNotification)(void) = NULL;
+
+    /* Read conversion result */
+    Local_u16Result = ADC_u16ReadResult();
+
+    switch (ADC_u8IsrSource) {
+    case ADC_ISR_SCAN:
+        if (ADC_u8Injecting == 1u) {
+            /* An injected conversion completed: deliver it, the scan state is untouched */
+            Local_pstInject = &ADC_stInjectQueue[ADC_u8InjectTail & (ADC_u8InjectQueueDepth - 1u)];
+            *Local_pstInject->Result = Local_u16Result;
+            Local_pvInjectNotification = Local_pstInject->NotificationFunc;
+            ADC_u8InjectTail++;
+            ADC_u8Injecting = 0u;
+        } else {
+            /* One scan slot has elapsed */
+            for (Local_u8Index = 0u; Local_u8Index < ADC_u8ScanNumOfChannels; Local_u8Index++) {
+                if (ADC_u16ScanDue[Local_u8Index] != 0u) {
+                    ADC_u16ScanDue[Local_u8Index]--;
+                }
+            }
+            if (ADC_u16SupplyDue != 0u) {
+                ADC_u16SupplyDue--;
+            }
+
+            if (ADC_u8ScanDiscard != 0u) {
+                /* The reference is still settling: discard the conversion and stay on the entry */
+                ADC_u8ScanDiscard--;
+            } else if (ADC_u8ScanSampleCount == ADC_SCAN_IDLE_SLOT) {
+                /* Nothing was due: the result of the idle conversion is discarded */
+                Local_u8SelectNext = 1u;
+            } else if (ADC_u8ScanSampleCount == ADC_SCAN_SUPPLY_SLOT) {
+                /* Accumulate the bandgap conversions, then derive AVCC from them */
+                ADC_u16ScanAccumulator += Local_u16Result;
+                ADC_u8SupplySampleCount++;
+                if (ADC_u8SupplySampleCount == ADC_u8OversamplingSamples[ADC_SUPPLY_OVERSAMPLING]) {
+                    ADC_voidStoreSupply(ADC_u16ScanAccumulator >> ADC_SUPPLY_OVERSAMPLING);
+                    ADC_u16ScanAccumulator = 0u;
+                    ADC_u8SupplySampleCount = 0u;
+                    ADC_u8ScanSampleCount = 0u;
+                    Local_u8SelectNext = 1u;
+                }
+            } else if (ADC_u8ScanZeroPhase == 1u) {
+                /* Auto-zero: accumulate as many conversions of the zero input as the entry will take */
+                ADC_u16ScanZeroAccumulator += Local_u16Result;
+                ADC_u8ScanSampleCount++;
+                if (ADC_u8ScanSampleCount == ADC_u8OversamplingSamples[ADC_pstScanChannels[ADC_u8ScanCursor].Oversampling]) {
+                    ADC_u8ScanSampleCount = 0u;
+                    ADC_u8ScanZeroPhase = 0u;
+                }
+            } else {
+                /* Accumulate 4^n conversions of the current entry */
+                Local_u8Oversampling = ADC_pstScanChannels[ADC_u8ScanCursor].Oversampling;
+                ADC_u16ScanAccumulator += Local_u16Result;
+                ADC_u8ScanSampleCount++;
+
+                if (ADC_u8ScanSampleCount == ADC_u8OversamplingSamples[Local_u8Oversampling]) {
+                    /* Decimate: the sum of 4^n conversions shifted right by n carries n extra bits.
+                     * Remove the auto-zero offset, bring auto-ranged results to one scale, filter, calibrate, check
+                     * the window, store into the back buffer and adapt the entry's period. */
+                    if (ADC_pstScanChannels[ADC_u8ScanCursor].AutoZero != 0u) {
+                        ADC_u16ScanAccumulator = ADC_u16SubtractOffset(ADC_u16ScanAccumulator, ADC_u16ScanZeroAccumulator,
+                                                                       Local_u8Oversampling);
+                        ADC_u16ScanZeroAccumulator = 0u;
+                    }
+                    Local_u16Result = ADC_u16ScanAccumulator >> Local_u8Oversampling;
+                    if (ADC_pstScanChannels[ADC_u8ScanCursor].Reference == ADC_REF_AUTO) {
+                        Local_u16Result = ADC_u16AutoRange(ADC_u8ScanCursor, Local_u16Result);
+                    }
+                    Local_u16Result = ADC_u16FilterSample(ADC_u8ScanCursor, Local_u16Result);
+                    ADC_u16ScanUncalibrated[ADC_u8ScanCursor] = Local_u16Result;
+                    Local_u16Result = ADC_u16Calibrate(ADC_u8ScanCursor, Local_u16Result);
+                    ADC_voidCheckWindow(ADC_u8ScanCursor, Local_u16Result);
+                    ADC_u16ScanTable[ADC_u8ScanFrontBuffer ^ 1u][ADC_u8ScanCursor] = Local_u16Result;
+                    ADC_voidAdaptPeriod(ADC_u8ScanCursor, Local_u16Result);
+                    ADC_u16ScanAccumulator = 0u;
+                    ADC_u8ScanSampleCount = 0u;
+                    ADC_u8ScanDirty = 1u;
+                    Local_u8SelectNext = 1u;
+                }
+            }
+
+#if (ADC_u8Conv_Mode == Auto_Trigger) && (ADC_u8ScanSkipIdleSlots == 1u)
+            if (Local_u8SelectNext == 1u) {
+                /* If nothing is due, skip the idle slots instead of converting them: the pass ends here, the
+                 * next due entry is selected below and the trigger is parked until its slot */
+                ADC_u16ScanParkSlots = ADC_u16ScanSkipToNextDue();
+                if (ADC_u16ScanParkSlots != 0u) {
+                    Local_u8PassDone = ADC_u8ScanDirty;
+                }
+            }
+#endif
+
+#if ADC_u16SupplyPeriod != 0u
+            if ((Local_u8SelectNext == 1u) && (ADC_u16SupplyDue == 0u)) {
+                /* The supply measurement goes first; the round robin then continues where it was */
+                ADC_u8ScanSampleCount = ADC_SCAN_SUPPLY_SLOT;
+                ADC_u16SupplyDue = ADC_u16SupplyPeriod;
+                ADC_u8ScanDiscard = ADC_u8BandgapSettleConversions;
+                Local_u8SelectNext = 0u;
+            }
+#endif
+
+            if (Local_u8SelectNext == 1u) {
+                /* Round robin over the due entries, starting after the last one converted.
+                 * The pass ends when the search wraps or nothing is due. */
+                Local_u8Index = ADC_u8ScanNextDue();
+                if (Local_u8Index == ADC_SCAN_IDLE_SLOT) {
+                    ADC_u8ScanSampleCount = ADC_SCAN_IDLE_SLOT;
+                    Local_u8PassDone = ADC_u8ScanDirty;
+                } else {
+                    if (Local_u8Index <= ADC_u8ScanCursor) {
+                        Local_u8PassDone = ADC_u8ScanDirty;
+                    }
+                    ADC_u8ScanCursor = Local_u8Index;
+                    ADC_u8ScanSampleCount = 0u;
+                    ADC_u8ScanZeroPhase = (ADC_pstScanChannels[Local_u8Index].AutoZero != 0u) ? 1u : 0u;
+                    ADC_u16ScanDue[Local_u8Index] = ADC_u16EntryPeriod(Local_u8Index);
+                }
+            }
+        }
+
+        /* Re-arm first so the callbacks do not delay the next sample */
+        if (ADC_u8InjectTail != ADC_u8InjectHead) {
+            /* Injected requests run before the next scan conversion, started at once */
+            ADC_u8Injecting = 1u;
+            ADC_voidSelectChannel(ADC_stInjectQueue[ADC_u8InjectTail & (ADC_u8InjectQueueDepth - 1u)].Channel);
+#if ADC_u8Conv_Mode == Auto_Trigger
+            CLR_BIT(ADCSRA, ADCSRA_ADATE);
+#endif
+            SET_BIT(ADCSRA, ADCSRA_ADSC);
+        } else {
+            /* Continue the scan on its current entry (or the bandgap), switching the reference first if it
+             * needs another one, and let a new reference or gain stage settle */
+            if (ADC_u8ScanSampleCount == ADC_SCAN_SUPPLY_SLOT) {
+                Local_u8Discard = ADC_u8SelectScanChannel(ADC_BANDGAP_CHANNEL);
+                Local_u8Settle = ADC_u8SelectReference(ADC_REF_AVCC);
+            } else {
+                Local_u8Discard = ADC_u8SelectScanChannel(ADC_u8ScanEntryChannel());
+                Local_u8Settle = ADC_u8SelectReference(ADC_u8EntryReference(ADC_u8ScanCursor));
+            }
+            /* A parked trigger gives the new reference its parked slots to settle without converting */
+            if (ADC_u16ScanParkSlots >= Local_u8Settle) {
+                Local_u8Settle = 0u;
+            } else {
+                Local_u8Settle -= (u8)ADC_u16ScanParkSlots;
+            }
+            if (Local_u8Discard < Local_u8Settle) {
+                Local_u8Discard = Local_u8Settle;
+            }
+            if (ADC_u8ScanDiscard < Local_u8Discard) {
+                ADC_u8ScanDiscard = Local_u8Discard;
+            }
+#if ADC_u8Conv_Mode == Manual
+            SET_BIT(ADCSRA, ADCSRA_ADSC);
+#elif ADC_u8Conv_Mode == Auto_Trigger
+            if (ADC_u16ScanParkSlots == 0u) {
+                /* Hand the ADC back to the trigger source if an injected request took it */
+                SET_BIT(ADCSRA, ADCSRA_ADATE);
+            } else {
+                /* Parked: no conversion until ADC_voidScanTick arms the trigger for the due slot */
+                CLR_BIT(ADCSRA, ADCSRA_ADATE);
+            }
+#endif
+        }
+
+        if (Local_pvInjectNotification != NULL) {
+            Local_pvInjectNotification();
+        }
+
+        if (Local_u8PassDone == 1u) {
+            /* Publish the completed pass and bump the sequence so readers can detect it */
+            ADC_MEMORY_BARRIER();
+            ADC_u8ScanFrontBuffer ^= 1u;
+            ADC_u8ScanValid = 1u;
+            ADC_u8ScanSequence++;
+            ADC_u8ScanDirty = 0u;
+
+            /* Copy the pass forward: entries that are not due in the next pass keep their last result */
+            for (Local_u8Index = 0u; Local_u8Index < ADC_u8ScanNumOfChannels; Local_u8Index++) {
+                ADC_u16ScanTable[ADC_u8ScanFrontBuffer ^ 1u][Local_u8Index] = ADC_u16ScanTable[ADC_u8ScanFrontBuffer][Local_u8Index];
+            }
+
+            if (ADC_pvScanNotificationFunc != NULL) {
+                ADC_pvScanNotificationFunc();
+            }
+        }
+        break;
+
+    case ADC_ISR_BURST:
+        /* Push into the ring, or count the sample as lost if the reader fell behind */
+        if ((u8)(ADC_u8BurstHead - ADC_u8BurstTail) <= ADC_u8BurstMask) {
+            ADC_pu16BurstBuffer[ADC_u8BurstHead & ADC_u8BurstMask] = Local_u16Result;
+            ADC_MEMORY_BARRIER();
+            ADC_u8BurstHead++;
+        } else {
+            ADC_u16BurstOverruns++;
+        }
+        break;
+
+    case ADC_ISR_SLEEP:
+        *ADC_u16Result = Local_u16Result;
+
+        /* Disable ADC interrupt and wake the sleeping caller */
+        CLR_BIT(ADCSRA, ADCSRA_ADIE);
+        ADC_u8SleepDone = 1u;
+        break;
+
+    case ADC_ISR_CHAIN:
+        ADC_u16Result[ADC_u8ChainIndex] = Local_u16Result;
+        ADC_u8ChainIndex++;
+        if (ADC_u8ChainIndex < ADC_u8ChainFlag) {
+            /* Start next conversion in the chain */
+            ADC_voidSelectChannel(ADC_ChannelArr[ADC_u8ChainIndex]);
+            SET_BIT(ADCSRA, ADCSRA_ADSC);
+        } else {
+            /* ADC is now idle */
+            ADC_u8BusyFlag = IDLE;
+
+            /* Disable ADC interrupt */
+            CLR_BIT(ADCSRA, ADCSRA_ADIE);
+
+            /* All conversions complete, invoke the callback */
+            ADC_pvCallBackNotificationFunc();
+        }
+        break;
+
+    default:
+        *ADC_u16Result = Local_u16Result;
+
+        /* ADC is now idle */
+        ADC_u8BusyFlag = IDLE;
+
+        /* Disable ADC interrupt */
+        CLR_BIT(ADCSRA, ADCSRA_ADIE);
+
+        /* Conversion complete, invoke the callback */
+        ADC_pvCallBackNotificationFunc();
+        break;
+    }
+}
@@ -83,7 +83,34 @@
  * 
  * ADC is located at I/O address 0x24. It is accessed as a 16-bit value.
  */
-#define ADC                 *((volatile uint16*)0x24)  /**< ADC Data Register (10-bit Resolution) */
+#define ADC                 *((volatile u16*)0x24)  /**< ADC Data Register (10-bit Resolution) */
+
+/**
+ * @brief MCU Control Register (MCUCR).
+ *
+ * This register holds the sleep mode selection and the sleep enable bit (the low nibble belongs to
+ * the external interrupt sense control and must be preserved).
+ * 
+ * - MCUCR_SE (Bit 7): Sleep Enable.
+ * - MCUCR_SM2 (Bit 6), MCUCR_SM1 (Bit 5), MCUCR_SM0 (Bit 4): Sleep Mode Select.
+ * 
+ * MCUCR is located at address 0x55.
+ */
+#define MCUCR               *((volatile u8*)0x55)  /**< MCU Control Register */
+#define MCUCR_SE            7u                      /**< Sleep Enable */
+#define MCUCR_SM2           6u                      /**< Sleep Mode Select Bit 2 */
+#define MCUCR_SM1           5u                      /**< Sleep Mode Select Bit 1 */
+#define MCUCR_SM0           4u                      /**< Sleep Mode Select Bit 0 */
+
+/**
+ * @brief Status Register (SREG).
+ *
+ * - SREG_I (Bit 7): Global Interrupt Enable.
+ * 
+ * SREG is located at address 0x5F.
+ */
+#define SREG                *((volatile u8*)0x5F)  /**< Status Register */
+#define SREG_I              7u                      /**< Global Interrupt Enable */
 
 
 #endif
@@ -0,0 +1,17 @@
+/*******************************************************************/
+/***************     Author: Youssef_Farid		   *****************/
+/***************     Layer: MCAL                   *****************/
+/***************     EEPROM_config                 *****************/
+/*******************************************************************/
+
+#ifndef EEPROM_CONFIG_H
+#define EEPROM_CONFIG_H
+
+/**
+ * @brief Macro to define the timeout while waiting for the previous write to finish.
+ *
+ * A byte write takes about 8.5 ms whatever the CPU clock; at 16 MHz that is well under 50000 polls.
+ */
+#define EEPROM_u32TimeOut                    50000u  /**< Polls of EEWE before giving up */
+
+#endif
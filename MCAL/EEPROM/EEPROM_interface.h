@@ -0,0 +1,74 @@
+/*******************************************************************/
+/***************     Author: Youssef_Farid		   *****************/
+/***************     Layer: MCAL                   *****************/
+/***************     EEPROM_interface              *****************/
+/*******************************************************************/
+
+#ifndef EEPROM_INTERFACE_H
+#define EEPROM_INTERFACE_H
+
+/**
+ * @brief Read one byte from the EEPROM.
+ *
+ * If a write is still in progress, the function first waits for it to finish.
+ *
+ * @param Copy_u16Address: EEPROM address (0 .. 1023).
+ * @param Copy_pu8Data: Pointer to store the byte.
+ * @return u8: Status of the operation:
+ * - '0u' on success,
+ * - '1u' if the address is out of range,
+ * - '2u' if the data pointer is NULL,
+ * - '3u' if the previous write did not finish in time.
+ */
+u8 EEPROM_u8ReadByte(u16 Copy_u16Address, u8* Copy_pu8Data);
+
+/**
+ * @brief Write one byte to the EEPROM.
+ *
+ * The function waits for the previous write to finish, then starts this one and returns without waiting
+ * for it (about 8.5 ms). A byte that already holds the value is not written again, to save endurance
+ * (about 100000 writes per cell).
+ *
+ * @note Global interrupts are disabled for the few cycles of the write sequence.
+ *
+ * @param Copy_u16Address: EEPROM address (0 .. 1023).
+ * @param Copy_u8Data: The byte to write.
+ * @return u8: Status of the operation:
+ * - '0u' on success,
+ * - '1u' if the address is out of range,
+ * - '3u' if the previous write did not finish in time.
+ */
+u8 EEPROM_u8WriteByte(u16 Copy_u16Address, u8 Copy_u8Data);
+
+/**
+ * @brief Read a block of bytes from the EEPROM.
+ *
+ * @param Copy_u16Address: EEPROM address of the first byte.
+ * @param Copy_pu8Data: Buffer to store the bytes.
+ * @param Copy_u16Length: Number of bytes to read.
+ * @return u8: Status of the operation:
+ * - '0u' on success,
+ * - '1u' if the block does not fit in the EEPROM,
+ * - '2u' if the buffer pointer is NULL,
+ * - '3u' if the previous write did not finish in time.
+ */
+u8 EEPROM_u8ReadBlock(u16 Copy_u16Address, u8* Copy_pu8Data, u16 Copy_u16Length);
+
+/**
+ * @brief Write a block of bytes to the EEPROM.
+ *
+ * The bytes are written one after the other, so the function blocks for about 8.5 ms per byte that
+ * changes.
+ *
+ * @param Copy_u16Address: EEPROM address of the first byte.
+ * @param Copy_pu8Data: The bytes to write.
+ * @param Copy_u16Length: Number of bytes to write.
+ * @return u8: Status of the operation:
+ * - '0u' on success,
+ * - '1u' if the block does not fit in the EEPROM,
+ * - '2u' if the data pointer is NULL,
+ * - '3u' if a write did not finish in time.
+ */
+u8 EEPROM_u8WriteBlock(u16 Copy_u16Address, const u8* Copy_pu8Data, u16 Copy_u16Length);
+
+#endif
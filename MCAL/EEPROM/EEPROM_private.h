@@ -0,0 +1,27 @@
+/*******************************************************************/
+/***************     Author: Youssef_Farid		   *****************/
+/***************     Layer: MCAL                   *****************/
+/***************     EEPROM_private                *****************/
+/*******************************************************************/
+
+#ifndef EEPROM_PRIVATE_H
+#define EEPROM_PRIVATE_H
+
+/**
+ * @brief Macro for the EEPROM size of the ATmega32, in bytes.
+ */
+#define EEPROM_SIZE             1024u
+
+/**
+ * @brief Macro for the address bits held by EEARH.
+ */
+#define EEPROM_High_Byte_Mask   0b00000011
+
+/**
+ * @brief Wait until the previous EEPROM write has finished.
+ *
+ * @return u8: NO_ERROR once EEWE is clear, TIMEOUT_ERR if it stays set for EEPROM_u32TimeOut polls.
+ */
+static u8 EEPROM_u8WaitReady(void);
+
+#endif
@@ -0,0 +1,179 @@
+/*******************************************************************/
+/***************     Author: Youssef_Farid		   *****************/
+/***************     Layer: MCAL                   *****************/
+/***************     EEPROM_program                *****************/
+/*******************************************************************/
+
+#include "STD_TYPES.h"
+#include "BIT_math.h"
+
+#include "EEPROM_register.h"
+#include "EEPROM_private.h"
+#include "EEPROM_config.h"
+#include "EEPROM_interface.h"
+
+/* 
+ * EEPROM Driver for an AVR Microcontroller
+ * 
+ * This driver reads and writes the 1 KB internal EEPROM by polling. It keeps settings that must
+ * survive a power cycle, like sensor calibration.
+ */
+
+/*
+ * Function: EEPROM_u8ReadByte
+ * ---------------------------
+ * Reads one byte. The CPU is halted for 4 cycles while EERE reads the cell, then EEDR holds the byte.
+ *
+ * Parameters:
+ *  - Copy_u16Address: EEPROM address.
+ *  - Copy_pu8Data: Pointer to store the byte.
+ *
+ * Returns:
+ *  - NO_ERROR if the byte is read.
+ *  - NULL_PTR_ERR if the data pointer is NULL.
+ *  - ERROR if the address is out of range.
+ *  - TIMEOUT_ERR if the previous write did not finish in time.
+ */
+u8 EEPROM_u8ReadByte(u16 Copy_u16Address, u8* Copy_pu8Data) {
+    u8 Local_u8ErrState = NO_ERROR;
+
+    if (Copy_pu8Data != NULL) {
+        if (Copy_u16Address < EEPROM_SIZE) {
+            /* The address must not change while a write is in progress */
+            Local_u8ErrState = EEPROM_u8WaitReady();
+            if (Local_u8ErrState == NO_ERROR) {
+                EEARH = (u8)(Copy_u16Address >> 8) & EEPROM_High_Byte_Mask;
+                EEARL = (u8)Copy_u16Address;
+                SET_BIT(EECR, EECR_EERE);
+                *Copy_pu8Data = EEDR;
+            }
+        } else {
+            Local_u8ErrState = ERROR;
+        }
+    } else {
+        /* Null pointer error */
+        Local_u8ErrState = NULL_PTR_ERR;
+    }
+
+    return Local_u8ErrState;
+}
+
+/*
+ * Function: EEPROM_u8WriteByte
+ * ----------------------------
+ * Writes one byte unless the cell already holds it.
+ * EEWE must be set within 4 cycles of EEMWE, so both are set by two back-to-back SBI instructions with
+ * global interrupts disabled; the C bit macros give no such guarantee at -O0. SREG is saved and restored,
+ * so the caller's interrupt state is kept.
+ *
+ * Parameters:
+ *  - Copy_u16Address: EEPROM address.
+ *  - Copy_u8Data: The byte to write.
+ *
+ * Returns:
+ *  - NO_ERROR if the write is started (or not needed).
+ *  - ERROR if the address is out of range.
+ *  - TIMEOUT_ERR if the previous write did not finish in time.
+ */
+u8 EEPROM_u8WriteByte(u16 Copy_u16Address, u8 Copy_u8Data) {
+    u8 Local_u8ErrState;
+    u8 Local_u8Current;
+    u8 Local_u8Sreg;
+
+    Local_u8ErrState = EEPROM_u8ReadByte(Copy_u16Address, &Local_u8Current);
+    if ((Local_u8ErrState == NO_ERROR) && (Local_u8Current != Copy_u8Data)) {
+        /* EEAR still holds the address and no write is in progress after the read */
+        EEDR = Copy_u8Data;
+
+        Local_u8Sreg = SREG;
+        __asm__ __volatile__ ("cli");
+        __asm__ __volatile__ ("sbi %0, %1" "\n\t" "sbi %0, %2"
+                              :
+                              : "I" (EECR_IO_ADDRESS), "I" (EECR_EEMWE), "I" (EECR_EEWE));
+        SREG = Local_u8Sreg;
+    }
+
+    return Local_u8ErrState;
+}
+
+/*
+ * Function: EEPROM_u8ReadBlock
+ * ----------------------------
+ * Reads Copy_u16Length consecutive bytes, stopping at the first error.
+ *
+ * Returns:
+ *  - NO_ERROR if every byte is read.
+ *  - NULL_PTR_ERR if the buffer pointer is NULL.
+ *  - ERROR if the block does not fit in the EEPROM.
+ *  - TIMEOUT_ERR if the previous write did not finish in time.
+ */
+u8 EEPROM_u8ReadBlock(u16 Copy_u16Address, u8* Copy_pu8Data, u16 Copy_u16Length) {
+    u8 Local_u8ErrState = NO_ERROR;
+    u16 Local_u16Index;
+
+    if (Copy_pu8Data != NULL) {
+        if ((Copy_u16Address < EEPROM_SIZE) && (Copy_u16Length <= (EEPROM_SIZE - Copy_u16Address))) {
+            for (Local_u16Index = 0u; (Local_u16Index < Copy_u16Length) && (Local_u8ErrState == NO_ERROR); Local_u16Index++) {
+                Local_u8ErrState = EEPROM_u8ReadByte(Copy_u16Address + Local_u16Index, &Copy_pu8Data[Local_u16Index]);
+            }
+        } else {
+            Local_u8ErrState = ERROR;
+        }
+    } else {
+        /* Null pointer error */
+        Local_u8ErrState = NULL_PTR_ERR;
+    }
+
+    return Local_u8ErrState;
+}
+
+/*
+ * Function: EEPROM_u8WriteBlock
+ * -----------------------------
+ * Writes Copy_u16Length consecutive bytes, stopping at the first error. Each write waits for the
+ * previous one, so the function returns while the last byte is still being written.
+ *
+ * Returns:
+ *  - NO_ERROR if every write is started.
+ *  - NULL_PTR_ERR if the data pointer is NULL.
+ *  - ERROR if the block does not fit in the EEPROM.
+ *  - TIMEOUT_ERR if a write did not finish in time.
+ */
+u8 EEPROM_u8WriteBlock(u16 Copy_u16Address, const u8* Copy_pu8Data, u16 Copy_u16Length) {
+    u8 Local_u8ErrState = NO_ERROR;
+    u16 Local_u16Index;
+
+    if (Copy_pu8Data != NULL) {
+        if ((Copy_u16Address < EEPROM_SIZE) && (Copy_u16Length <= (EEPROM_SIZE - Copy_u16Address))) {
+            for (Local_u16Index = 0u; (Local_u16Index < Copy_u16Length) && (Local_u8ErrState == NO_ERROR); Local_u16Index++) {
+                Local_u8ErrState = EEPROM_u8WriteByte(Copy_u16Address + Local_u16Index, Copy_pu8Data[Local_u16Index]);
+            }
+        } else {
+            Local_u8ErrState = ERROR;
+        }
+    } else {
+        /* Null pointer error */
+        Local_u8ErrState = NULL_PTR_ERR;
+    }
+
+    return Local_u8ErrState;
+}
+
+/*
+ * Function: EEPROM_u8WaitReady
+ * ----------------------------
+ * Polls EEWE until the previous write has finished.
+ */
+static u8 EEPROM_u8WaitReady(void) {
+    u8 Local_u8ErrState = NO_ERROR;
+    u32 Local_u32Counter = 0u;
+
+    while ((GET_BIT(EECR, EECR_EEWE) == 1u) && (Local_u32Counter < EEPROM_u32TimeOut)) {
+        Local_u32Counter++;
+    }
+    if (Local_u32Counter == EEPROM_u32TimeOut) {
+        Local_u8ErrState = TIMEOUT_ERR;
+    }
+
+    return Local_u8ErrState;
+}
@@ -0,0 +1,55 @@
+/*******************************************************************/
+/***************     Author: Youssef_Farid		   *****************/
+/***************     Layer: MCAL                   *****************/
+/***************     EEPROM_register               *****************/
+/*******************************************************************/
+
+#ifndef EEPROM_REGISTER_H
+#define EEPROM_REGISTER_H
+
+/**
+ * @brief Macros for EEPROM Register and Bit Definitions.
+ */
+
+/**
+ * @brief EEPROM Address Registers (EEARH, EEARL).
+ *
+ * EEARL holds the low byte and EEARH bits 1:0 the high bits of the 10-bit EEPROM address.
+ *
+ * EEARH is located at address 0x3F and EEARL at 0x3E.
+ */
+#define EEARH               *((volatile u8*)0x3F)  /**< EEPROM Address Register High */
+#define EEARL               *((volatile u8*)0x3E)  /**< EEPROM Address Register Low */
+
+/**
+ * @brief EEPROM Data Register (EEDR).
+ *
+ * EEDR is located at address 0x3D.
+ */
+#define EEDR                *((volatile u8*)0x3D)  /**< EEPROM Data Register */
+
+/**
+ * @brief EEPROM Control Register (EECR).
+ *
+ * - EECR_EERIE (Bit 3): EEPROM Ready Interrupt Enable.
+ * - EECR_EEMWE (Bit 2): EEPROM Master Write Enable.
+ * - EECR_EEWE (Bit 1): EEPROM Write Enable.
+ * - EECR_EERE (Bit 0): EEPROM Read Enable.
+ *
+ * EECR is located at address 0x3C, which is I/O address 0x1C (EECR_IO_ADDRESS) for the SBI instruction.
+ */
+#define EECR                *((volatile u8*)0x3C)  /**< EEPROM Control Register */
+#define EECR_IO_ADDRESS     0x1Cu                   /**< I/O space address of EECR */
+#define EECR_EERIE          3u                      /**< EEPROM Ready Interrupt Enable */
+#define EECR_EEMWE          2u                      /**< EEPROM Master Write Enable */
+#define EECR_EEWE           1u                      /**< EEPROM Write Enable */
+#define EECR_EERE           0u                      /**< EEPROM Read Enable */
+
+/**
+ * @brief Status Register (SREG).
+ *
+ * SREG is located at address 0x5F.
+ */
+#define SREG                *((volatile u8*)0x5F)  /**< Status Register */
+
+#endif
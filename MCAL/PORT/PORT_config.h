@@ -33,7 +33,7 @@
 #define PORTA_PIN3_DIR    INPUT   /**< Pin A3 direction: INPUT */
 #define PORTA_PIN4_DIR    INPUT   /**< Pin A4 direction: INPUT */
 #define PORTA_PIN5_DIR    INPUT   /**< Pin A5 direction: INPUT */
-#define PORTA_PIN6_DIR    INPUT   /**< Pin A6 direction: INPUT */
+#define PORTA_PIN6_DIR    INPUT   /**< Pin A6 direction: INPUT (LED2 with FIRE_SENSOR_COMPARATOR in main.c) */
 #define PORTA_PIN7_DIR    OUTPUT  /**< Pin A7 direction: OUTPUT */
 
 /**
@@ -42,7 +42,7 @@
 #define PORTB_PIN0_DIR    OUTPUT  /**< Pin B0 direction: OUTPUT */
 #define PORTB_PIN1_DIR    OUTPUT  /**< Pin B1 direction: OUTPUT */
 #define PORTB_PIN2_DIR    INPUT   /**< Pin B2 direction: INPUT */
-#define PORTB_PIN3_DIR    OUTPUT  /**< Pin B3 direction: OUTPUT */
+#define PORTB_PIN3_DIR    OUTPUT  /**< Pin B3 direction: OUTPUT (LED2; AIN1 input with FIRE_SENSOR_COMPARATOR in main.c) */
 #define PORTB_PIN4_DIR    OUTPUT  /**< Pin B4 direction: OUTPUT */
 #define PORTB_PIN5_DIR    OUTPUT  /**< Pin B5 direction: OUTPUT */
 #define PORTB_PIN6_DIR    OUTPUT  /**< Pin B6 direction: OUTPUT */
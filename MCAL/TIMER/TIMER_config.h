@@ -0,0 +1,50 @@
+/*******************************************************************/
+/***************     Author: Youssef_Farid		   *****************/
+/***************     Layer: MCAL                   *****************/
+/***************     TIMER_config                  *****************/
+/*******************************************************************/
+
+#ifndef TIMER_CONFIG_H
+#define TIMER_CONFIG_H
+
+/**
+ * @brief Macro for selecting the Timer/Counter0 clock prescaler.
+ *
+ * Options:
+ *  - TIMER_Division_by_1: Timer clock = system clock.
+ *  - TIMER_Division_by_8: Timer clock = system clock / 8.
+ *  - TIMER_Division_by_64: Timer clock = system clock / 64.
+ *  - TIMER_Division_by_256: Timer clock = system clock / 256.
+ *  - TIMER_Division_by_1024: Timer clock = system clock / 1024.
+ */
+#define TIMER0_u8Prescaler                   TIMER_Division_by_64  /**< Timer/Counter0 prescaler option */
+
+/**
+ * @brief Macro to define the Timer/Counter0 compare value.
+ *
+ * Timer/Counter0 runs in CTC mode, so the compare match period is
+ * (TIMER0_u8CompareValue + 1) * prescaler / F_CPU.
+ * With F_CPU = 16 MHz and TIMER_Division_by_64, 249 gives a 1 kHz compare match rate.
+ */
+#define TIMER0_u8CompareValue                249u  /**< Timer/Counter0 compare value (CTC top) */
+
+/**
+ * @brief Macro for selecting the Timer/Counter2 clock prescaler.
+ *
+ * Options:
+ *  - TIMER2_Division_by_1, TIMER2_Division_by_8, TIMER2_Division_by_32, TIMER2_Division_by_64,
+ *    TIMER2_Division_by_128, TIMER2_Division_by_256, TIMER2_Division_by_1024.
+ */
+#define TIMER2_u8Prescaler                   TIMER2_Division_by_8  /**< Timer/Counter2 prescaler option */
+
+/**
+ * @brief Macro to define the Timer/Counter2 compare value.
+ *
+ * Timer/Counter2 runs in CTC mode, so the compare match period is
+ * (TIMER2_u8CompareValue + 1) * prescaler / F_CPU.
+ * With F_CPU = 16 MHz and TIMER2_Division_by_8, 99 gives a 50 us period, a bit more than the
+ * 37 us an HD44780 takes for most instructions.
+ */
+#define TIMER2_u8CompareValue                99u  /**< Timer/Counter2 compare value (CTC top) */
+
+#endif
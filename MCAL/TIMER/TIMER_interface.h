@@ -0,0 +1,91 @@
+/*******************************************************************/
+/***************     Author: Youssef_Farid		   *****************/
+/***************     Layer: MCAL                   *****************/
+/***************     TIMER_interface               *****************/
+/*******************************************************************/
+
+#ifndef TIMER_INTERFACE_H
+#define TIMER_INTERFACE_H
+
+/**
+ * @brief Initialize Timer/Counter0 as a periodic compare match source.
+ *
+ * This function puts Timer/Counter0 in CTC (Clear Timer on Compare match) mode with the compare
+ * value and prescaler from TIMER_config.h, and enables the compare match interrupt. The timer starts
+ * counting as soon as the function returns.
+ *
+ * The compare match interrupt is always enabled: servicing it is what clears the compare flag
+ * (OCF0), and a peripheral auto-triggered by Timer/Counter0 compare match (such as the ADC) only
+ * starts on a new rising edge of that flag.
+ */
+void TIMER0_voidInit(void);
+
+/**
+ * @brief Change the Timer/Counter0 compare value.
+ *
+ * @param Copy_u8CompareValue: The new CTC top value. The compare match period becomes
+ * (Copy_u8CompareValue + 1) * prescaler / F_CPU.
+ */
+void TIMER0_voidSetCompareValue(u8 Copy_u8CompareValue);
+
+/**
+ * @brief Set the callback function for the Timer/Counter0 compare match interrupt.
+ *
+ * @param Copy_pvCallBackFunc: Pointer to the function called on every compare match.
+ * @return u8: Status of the operation:
+ * - '0u' on success,
+ * - '2u' if the callback pointer is NULL.
+ */
+u8 TIMER0_u8SetCallBack(void(*Copy_pvCallBackFunc)(void));
+
+/**
+ * @brief Initialize Timer/Counter2 as a periodic compare match source.
+ *
+ * This function puts Timer/Counter2 in CTC mode with the compare value and prescaler from
+ * TIMER_config.h and starts it. Unlike Timer/Counter0, the compare match interrupt is left disabled:
+ * its user enables it while it has work for the tick, and disables it when idle.
+ */
+void TIMER2_voidInit(void);
+
+/**
+ * @brief Enable the Timer/Counter2 compare match interrupt.
+ *
+ * Safe to call from any context, an ISR included: the TIMSK update runs with interrupts off.
+ */
+void TIMER2_voidEnableInterrupt(void);
+
+/**
+ * @brief Disable the Timer/Counter2 compare match interrupt.
+ *
+ * The timer keeps counting, so the tick phase is kept when the interrupt is enabled again.
+ */
+void TIMER2_voidDisableInterrupt(void);
+
+/**
+ * @brief Set the callback function for the Timer/Counter2 compare match interrupt.
+ *
+ * @param Copy_pvCallBackFunc: Pointer to the function called on every compare match.
+ * @return u8: Status of the operation:
+ * - '0u' on success,
+ * - '2u' if the callback pointer is NULL.
+ */
+u8 TIMER2_u8SetCallBack(void(*Copy_pvCallBackFunc)(void));
+
+/**
+ * @brief Start Timer/Counter1 as a CPU cycle counter.
+ *
+ * Timer/Counter1 runs in normal mode at the CPU clock, from 0. It is meant for timing a code section
+ * with TIMER1_u16GetCycles, so the section has to be shorter than 65536 cycles (4 ms at 16 MHz), and
+ * interrupts should be off for the reading to exclude them.
+ */
+void TIMER1_voidStartCycleCounter(void);
+
+/**
+ * @brief Read the number of CPU cycles since TIMER1_voidStartCycleCounter.
+ *
+ * @return u16: The cycles counted, including the fixed cost of the start and read calls. Time an empty
+ * section the same way to measure that cost.
+ */
+u16 TIMER1_u16GetCycles(void);
+
+#endif
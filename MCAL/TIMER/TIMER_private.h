@@ -0,0 +1,48 @@
+/*******************************************************************/
+/***************     Author: Youssef_Farid		   *****************/
+/***************     Layer: MCAL                   *****************/
+/***************     TIMER_private                 *****************/
+/*******************************************************************/
+
+#ifndef TIMER_PRIVATE_H
+#define TIMER_PRIVATE_H
+
+/**
+ * @brief Macros for the timer clock prescaler options and bit positions.
+ *
+ * These macros are the Clock Select (CS2:0) values of TCCR0:
+ * - TIMER_NO_CLOCK: Timer stopped.
+ * - TIMER_Division_by_1: Timer clock = system clock.
+ * - TIMER_Division_by_8: Timer clock = system clock / 8.
+ * - TIMER_Division_by_64: Timer clock = system clock / 64.
+ * - TIMER_Division_by_256: Timer clock = system clock / 256.
+ * - TIMER_Division_by_1024: Timer clock = system clock / 1024.
+ *
+ * TIMER_Prescaler_Bit_Mask is used to clear the clock select bits, and TIMER_Prescaler_Bit_Pos
+ * defines the bit position for setting the prescaler value.
+ */
+#define TIMER_NO_CLOCK              0u
+#define TIMER_Division_by_1         1u
+#define TIMER_Division_by_8         2u
+#define TIMER_Division_by_64        3u
+#define TIMER_Division_by_256       4u
+#define TIMER_Division_by_1024      5u
+
+#define TIMER_Prescaler_Bit_Mask    0b11111000
+#define TIMER_Prescaler_Bit_Pos     0u
+
+/**
+ * @brief Clock Select (CS22:0) values of TCCR2.
+ *
+ * Timer/Counter2 has its own prescaler, with two more steps than Timer/Counter0
+ * (system clock / 32 and / 128). It uses the same bit mask and position.
+ */
+#define TIMER2_Division_by_1        1u
+#define TIMER2_Division_by_8        2u
+#define TIMER2_Division_by_32       3u
+#define TIMER2_Division_by_64       4u
+#define TIMER2_Division_by_128      5u
+#define TIMER2_Division_by_256      6u
+#define TIMER2_Division_by_1024     7u
+
+#endif
@@ -0,0 +1,213 @@
+/*******************************************************************/
+/***************     Author: Youssef_Farid		   *****************/
+/***************     Layer: MCAL                   *****************/
+/***************     TIMER_program                 *****************/
+/*******************************************************************/
+
+#include "STD_TYPES.h"
+#include "BIT_math.h"
+
+#include "TIMER_register.h"
+#include "TIMER_private.h"
+#include "TIMER_config.h"
+#include "TIMER_interface.h"
+
+/* 
+ * Timer Driver for an AVR Microcontroller
+ * 
+ * This driver runs Timer/Counter0 in CTC mode as a periodic tick. The tick is used
+ * to pace other peripherals (for example the ADC auto trigger) and can call an
+ * application callback on every compare match.
+ *
+ * Timer/Counter2 runs in CTC mode as a second tick, whose compare match interrupt is
+ * switched on and off by its user (for example to drain a transmit queue).
+ */
+
+/* Global Variables */
+static void (*TIMER0_pvCallBackFunc)(void) = NULL;  // Callback function pointer for compare match
+static void (*TIMER2_pvCallBackFunc)(void) = NULL;  // Callback function pointer for Timer/Counter2 compare match
+
+/*
+ * Function: TIMER0_voidInit
+ * -------------------------
+ * Initializes Timer/Counter0 in CTC mode with the configured compare value and prescaler,
+ * and enables the compare match interrupt.
+ */
+void TIMER0_voidInit(void) {
+    /* Stop the timer while it is being configured */
+    TCCR0 &= TIMER_Prescaler_Bit_Mask;
+
+    /* CTC mode, OC0 pin disconnected */
+    CLR_BIT(TCCR0, TCCR0_WGM00);
+    SET_BIT(TCCR0, TCCR0_WGM01);
+    CLR_BIT(TCCR0, TCCR0_COM00);
+    CLR_BIT(TCCR0, TCCR0_COM01);
+
+    /* Compare value and counter reset */
+    OCR0 = TIMER0_u8CompareValue;
+    TCNT0 = 0u;
+
+    /* Clear a pending compare flag, then enable the compare match interrupt */
+    TIFR = (u8)(1u << TIFR_OCF0);  // Write-1-to-clear: a read-modify-write would clear the other timers' flags too
+    SET_BIT(TIMSK, TIMSK_OCIE0);
+
+    /* Start the timer with the configured prescaler */
+    TCCR0 |= TIMER0_u8Prescaler << TIMER_Prescaler_Bit_Pos;
+}
+
+/*
+ * Function: TIMER0_voidSetCompareValue
+ * ------------------------------------
+ * Changes the CTC top value of Timer/Counter0.
+ */
+void TIMER0_voidSetCompareValue(u8 Copy_u8CompareValue) {
+    OCR0 = Copy_u8CompareValue;
+}
+
+/*
+ * Function: TIMER0_u8SetCallBack
+ * ------------------------------
+ * Sets the function called from the Timer/Counter0 compare match ISR.
+ *
+ * Returns:
+ *  - NO_ERROR if the callback is set.
+ *  - NULL_PTR_ERR if the callback pointer is NULL.
+ */
+u8 TIMER0_u8SetCallBack(void(*Copy_pvCallBackFunc)(void)) {
+    u8 Local_u8ErrState = NO_ERROR;
+
+    if (Copy_pvCallBackFunc != NULL) {
+        TIMER0_pvCallBackFunc = Copy_pvCallBackFunc;
+    } else {
+        /* Null pointer error */
+        Local_u8ErrState = NULL_PTR_ERR;
+    }
+
+    return Local_u8ErrState;
+}
+
+/*
+ * Interrupt Service Routine (ISR) for Timer/Counter0 compare match
+ * ----------------------------------------------------------------
+ * Entering this ISR clears OCF0 in hardware, which re-arms any auto trigger on the flag.
+ * The callback is invoked if one is set.
+ */
+void __vector_10(void) __attribute__((signal));
+void __vector_10(void) {
+    if (TIMER0_pvCallBackFunc != NULL) {
+        TIMER0_pvCallBackFunc();
+    }
+}
+
+/*
+ * Function: TIMER2_voidInit
+ * -------------------------
+ * Initializes Timer/Counter2 in CTC mode with the configured compare value and prescaler.
+ * The compare match interrupt is left disabled.
+ */
+void TIMER2_voidInit(void) {
+    /* Stop the timer while it is being configured */
+    TCCR2 &= TIMER_Prescaler_Bit_Mask;
+
+    /* CTC mode, OC2 pin disconnected */
+    CLR_BIT(TCCR2, TCCR2_WGM20);
+    SET_BIT(TCCR2, TCCR2_WGM21);
+    CLR_BIT(TCCR2, TCCR2_COM20);
+    CLR_BIT(TCCR2, TCCR2_COM21);
+
+    /* Compare value and counter reset */
+    OCR2 = TIMER2_u8CompareValue;
+    TCNT2 = 0u;
+
+    /* Interrupt off, and no stale compare flag to fire when it is enabled */
+    CLR_BIT(TIMSK, TIMSK_OCIE2);
+    TIFR = (u8)(1u << TIFR_OCF2);  // Write-1-to-clear: a read-modify-write would clear the other timers' flags too
+
+    /* Start the timer with the configured prescaler */
+    TCCR2 |= TIMER2_u8Prescaler << TIMER_Prescaler_Bit_Pos;
+}
+
+/*
+ * Function: TIMER2_voidEnableInterrupt
+ * ------------------------------------
+ * Enables the Timer/Counter2 compare match interrupt.
+ *
+ * TIMSK is outside the sbi/cbi range, so this is a read-modify-write. It runs with interrupts off,
+ * or an ISR that changes another TIMSK bit in between would have its change undone.
+ */
+void TIMER2_voidEnableInterrupt(void) {
+    u8 Local_u8Sreg = SREG;
+
+    __asm__ __volatile__ ("cli" ::: "memory");
+    SET_BIT(TIMSK, TIMSK_OCIE2);
+    SREG = Local_u8Sreg;
+}
+
+/*
+ * Function: TIMER2_voidDisableInterrupt
+ * -------------------------------------
+ * Disables the Timer/Counter2 compare match interrupt. The timer keeps counting.
+ * Like the enable, the read-modify-write of TIMSK runs with interrupts off.
+ */
+void TIMER2_voidDisableInterrupt(void) {
+    u8 Local_u8Sreg = SREG;
+
+    __asm__ __volatile__ ("cli" ::: "memory");
+    CLR_BIT(TIMSK, TIMSK_OCIE2);
+    SREG = Local_u8Sreg;
+}
+
+/*
+ * Function: TIMER2_u8SetCallBack
+ * ------------------------------
+ * Sets the function called from the Timer/Counter2 compare match ISR.
+ *
+ * Returns:
+ *  - NO_ERROR if the callback is set.
+ *  - NULL_PTR_ERR if the callback pointer is NULL.
+ */
+u8 TIMER2_u8SetCallBack(void(*Copy_pvCallBackFunc)(void)) {
+    u8 Local_u8ErrState = NO_ERROR;
+
+    if (Copy_pvCallBackFunc != NULL) {
+        TIMER2_pvCallBackFunc = Copy_pvCallBackFunc;
+    } else {
+        /* Null pointer error */
+        Local_u8ErrState = NULL_PTR_ERR;
+    }
+
+    return Local_u8ErrState;
+}
+
+/*
+ * Function: TIMER1_voidStartCycleCounter
+ * --------------------------------------
+ * Starts Timer/Counter1 from 0 in normal mode, clocked by the CPU clock (no prescaler).
+ */
+void TIMER1_voidStartCycleCounter(void) {
+    TCCR1B = 0u;
+    TCCR1A = 0u;
+    TCNT1 = 0u;
+    TCCR1B = TIMER_Division_by_1 << TIMER_Prescaler_Bit_Pos;
+}
+
+/*
+ * Function: TIMER1_u16GetCycles
+ * -----------------------------
+ * Returns the Timer/Counter1 count, the CPU cycles since the counter was started.
+ */
+u16 TIMER1_u16GetCycles(void) {
+    return TCNT1;
+}
+
+/*
+ * Interrupt Service Routine (ISR) for Timer/Counter2 compare match
+ * ----------------------------------------------------------------
+ * The callback is invoked if one is set.
+ */
+void __vector_4(void) __attribute__((signal));
+void __vector_4(void) {
+    if (TIMER2_pvCallBackFunc != NULL) {
+        TIMER2_pvCallBackFunc();
+    }
+}
@@ -0,0 +1,139 @@
+/*******************************************************************/
+/***************     Author: Youssef_Farid		   *****************/
+/***************     Layer: MCAL                   *****************/
+/***************     TIMER_register                *****************/
+/*******************************************************************/
+
+#ifndef TIMER_REGISTER_H
+#define TIMER_REGISTER_H
+
+/**
+ * @brief Macros for Timer Register and Bit Definitions.
+ *
+ * These macros provide access to the Timer/Counter0 and Timer/Counter2 registers and the shared timer
+ * interrupt mask and flag registers.
+ */
+
+/**
+ * @brief Timer/Counter0 Control Register (TCCR0).
+ *
+ * - TCCR0_FOC0 (Bit 7): Force Output Compare.
+ * - TCCR0_WGM00 (Bit 6): Waveform Generation Mode bit 0.
+ * - TCCR0_COM01 (Bit 5), TCCR0_COM00 (Bit 4): Compare Output Mode.
+ * - TCCR0_WGM01 (Bit 3): Waveform Generation Mode bit 1.
+ * - CS02:0 (Bits 2:0): Clock Select.
+ *
+ * TCCR0 is located at address 0x53.
+ */
+#define TCCR0               *((volatile u8*)0x53)  /**< Timer/Counter0 Control Register */
+#define TCCR0_FOC0          7u                      /**< Force Output Compare */
+#define TCCR0_WGM00         6u                      /**< Waveform Generation Mode bit 0 */
+#define TCCR0_COM01         5u                      /**< Compare Output Mode bit 1 */
+#define TCCR0_COM00         4u                      /**< Compare Output Mode bit 0 */
+#define TCCR0_WGM01         3u                      /**< Waveform Generation Mode bit 1 */
+
+/**
+ * @brief Timer/Counter0 Register (TCNT0).
+ *
+ * TCNT0 is located at address 0x52.
+ */
+#define TCNT0               *((volatile u8*)0x52)  /**< Timer/Counter0 Register */
+
+/**
+ * @brief Timer/Counter0 Output Compare Register (OCR0).
+ *
+ * OCR0 is located at address 0x5C.
+ */
+#define OCR0                *((volatile u8*)0x5C)  /**< Timer/Counter0 Output Compare Register */
+
+/**
+ * @brief Timer/Counter2 Control Register (TCCR2).
+ *
+ * - TCCR2_FOC2 (Bit 7): Force Output Compare.
+ * - TCCR2_WGM20 (Bit 6): Waveform Generation Mode bit 0.
+ * - TCCR2_COM21 (Bit 5), TCCR2_COM20 (Bit 4): Compare Output Mode.
+ * - TCCR2_WGM21 (Bit 3): Waveform Generation Mode bit 1.
+ * - CS22:0 (Bits 2:0): Clock Select.
+ *
+ * TCCR2 is located at address 0x45.
+ */
+#define TCCR2               *((volatile u8*)0x45)  /**< Timer/Counter2 Control Register */
+#define TCCR2_FOC2          7u                      /**< Force Output Compare */
+#define TCCR2_WGM20         6u                      /**< Waveform Generation Mode bit 0 */
+#define TCCR2_COM21         5u                      /**< Compare Output Mode bit 1 */
+#define TCCR2_COM20         4u                      /**< Compare Output Mode bit 0 */
+#define TCCR2_WGM21         3u                      /**< Waveform Generation Mode bit 1 */
+
+/**
+ * @brief Timer/Counter2 Register (TCNT2).
+ *
+ * TCNT2 is located at address 0x44.
+ */
+#define TCNT2               *((volatile u8*)0x44)  /**< Timer/Counter2 Register */
+
+/**
+ * @brief Timer/Counter2 Output Compare Register (OCR2).
+ *
+ * OCR2 is located at address 0x43.
+ */
+#define OCR2                *((volatile u8*)0x43)  /**< Timer/Counter2 Output Compare Register */
+
+/**
+ * @brief Timer/Counter1 Control Registers (TCCR1A, TCCR1B).
+ *
+ * Timer/Counter1 is only used as a cycle counter, in normal mode: both registers are written whole.
+ * - CS12:0 (TCCR1B Bits 2:0): Clock Select.
+ *
+ * TCCR1A is located at address 0x4F, TCCR1B at address 0x4E.
+ */
+#define TCCR1A              *((volatile u8*)0x4F)  /**< Timer/Counter1 Control Register A */
+#define TCCR1B              *((volatile u8*)0x4E)  /**< Timer/Counter1 Control Register B */
+
+/**
+ * @brief Timer/Counter1 Register (TCNT1).
+ *
+ * A 16-bit register read low byte first through the shared TEMP register, which a 16-bit access does.
+ * TCNT1 is located at address 0x4C (TCNT1L) and 0x4D (TCNT1H).
+ */
+#define TCNT1               *((volatile u16*)0x4C) /**< Timer/Counter1 Register */
+
+/**
+ * @brief Timer/Counter Interrupt Mask Register (TIMSK).
+ *
+ * - TIMSK_OCIE2 (Bit 7): Timer/Counter2 Output Compare Match Interrupt Enable.
+ * - TIMSK_TOIE2 (Bit 6): Timer/Counter2 Overflow Interrupt Enable.
+ * - TIMSK_OCIE0 (Bit 1): Timer/Counter0 Output Compare Match Interrupt Enable.
+ * - TIMSK_TOIE0 (Bit 0): Timer/Counter0 Overflow Interrupt Enable.
+ *
+ * TIMSK is located at address 0x59.
+ */
+#define TIMSK               *((volatile u8*)0x59)  /**< Timer/Counter Interrupt Mask Register */
+#define TIMSK_OCIE2         7u                      /**< Timer/Counter2 Compare Match Interrupt Enable */
+#define TIMSK_TOIE2         6u                      /**< Timer/Counter2 Overflow Interrupt Enable */
+#define TIMSK_OCIE0         1u                      /**< Timer/Counter0 Compare Match Interrupt Enable */
+#define TIMSK_TOIE0         0u                      /**< Timer/Counter0 Overflow Interrupt Enable */
+
+/**
+ * @brief Timer/Counter Interrupt Flag Register (TIFR).
+ *
+ * - TIFR_OCF2 (Bit 7): Timer/Counter2 Output Compare Flag.
+ * - TIFR_TOV2 (Bit 6): Timer/Counter2 Overflow Flag.
+ * - TIFR_OCF0 (Bit 1): Timer/Counter0 Output Compare Flag.
+ * - TIFR_TOV0 (Bit 0): Timer/Counter0 Overflow Flag.
+ *
+ * TIFR is located at address 0x58.
+ */
+#define TIFR                *((volatile u8*)0x58)  /**< Timer/Counter Interrupt Flag Register */
+#define TIFR_OCF2           7u                      /**< Timer/Counter2 Output Compare Flag */
+#define TIFR_TOV2           6u                      /**< Timer/Counter2 Overflow Flag */
+#define TIFR_OCF0           1u                      /**< Timer/Counter0 Output Compare Flag */
+#define TIFR_TOV0           0u                      /**< Timer/Counter0 Overflow Flag */
+
+/**
+ * @brief Status Register (SREG).
+ *
+ * SREG is located at address 0x5F.
+ */
+#define SREG                *((volatile u8*)0x5F)  /**< Status Register */
+
+#endif
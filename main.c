@@ -19,15 +19,50 @@
 #define KPD_NO_PRESSED_KEY 0xff
 #define PASSWORD "12" // Example password for a 2x2 keypad
 
-#define LVL_0_LIGHT 2550u
-#define LVL_1_LIGHT	2295u
-#define LVL_2_LIGHT	1530u
-#define LVL_3_LIGHT	1020u
-#define LVL_4_LIGHT	510u
-#define LVL_5_LIGHT	253u
+/* Light levels in lux, one doubling (an equal step of perceived brightness) apart */
+#define LVL_0_LIGHT 50u
+#define LVL_1_LIGHT	100u
+#define LVL_2_LIGHT	200u
+#define LVL_3_LIGHT	400u
+#define LVL_4_LIGHT	800u
+#define LVL_5_LIGHT	1600u
+#define LVL_HYSTERESIS(LVL)	((LVL) / 8u)	/* Readings have to go 12.5% past a level to leave it */
+#define NUM_OF_LIGHT_LVLS	6u
+#define LIGHT_BAR_LEDS	5u
 
 #define NUM_OF_CHANNELS 2u
 
+#define FIRE_GLYPH 0u	/* Glyph ID of the fire icon in the LCD glyph cache */
+#define FIRE_TEMP	50u	/* The LM35 raises the fire alarm above this temperature, in degrees */
+
+/* 1: the board has a fire sensor divider on AIN1 (PB3), read by the analog comparator, and LED2 moved
+ * to PA6 to free PB3. 0: the original board, where the LM35 reading is the only fire check */
+#define FIRE_SENSOR_COMPARATOR	0u
+
+/* LM35 (10 mV per degree), read as an auto-ranged 12-bit scan result in 2.56 V counts */
+#define TEMP_TO_COUNTS(C)	((u16)(((u32)(C) * 10UL * 4095UL) / Vref_INTERNAL))
+#define FAN_OFF_TEMP	23u
+#define FAN_ON_TEMP		25u
+#define FAN_HYSTERESIS	4u	/* About 0.25 degrees in 12-bit counts */
+
+/* Two-point calibration of the LM35 channel, stored in the EEPROM. The keys are password digits too,
+ * so they only act in calibration mode, entered by typing the password again from the main loop */
+#define CAL_POINT1_KEY		'3'
+#define CAL_POINT2_KEY		'4'
+#define CAL_PASSWORD_LENGTH	2u
+#define CAL_POINT1_TEMP		25u		/* Known temperatures of the two points, in degrees */
+#define CAL_POINT2_TEMP		50u
+#define CAL_EEPROM_ADDRESS	0x000u
+#define CAL_EEPROM_MAGIC	0xCAu
+
+/* 1: time the LM35 conversions with Timer/Counter1 at start-up and show the cycles on the LCD */
+#define MEASURE_LM35_CYCLES	0u
+#define MEASURE_SAMPLES		64u
+
+/* Fastest scan periods in Timer/Counter0 ticks (1 ms); the ADC backs them off while readings are stable */
+#define TEMP_PERIOD		250u	/* Temperature changes over seconds */
+#define LIGHT_PERIOD	20u		/* Light changes over hundreds of milliseconds */
+
 /*Defines Section End*/
 
 
@@ -37,19 +72,48 @@ LED_T redLED = {DIO_u8PORTB, DIO_u8PIN0, Active_High};
 LED_T greenLED = {DIO_u8PORTB, DIO_u8PIN1, Active_High};
 
 LED_T LED1 = {DIO_u8PORTA, DIO_u8PIN7, Active_High};
+#if FIRE_SENSOR_COMPARATOR == 1u
+LED_T LED2 = {DIO_u8PORTA, DIO_u8PIN6, Active_High};	/* PB3 is the comparator's AIN1 input */
+#else
 LED_T LED2 = {DIO_u8PORTB, DIO_u8PIN3, Active_High};
+#endif
 LED_T LED3 = {DIO_u8PORTB, DIO_u8PIN4, Active_High};
 LED_T LED4 = {DIO_u8PORTB, DIO_u8PIN5, Active_High};
 LED_T LED5 = {DIO_u8PORTB, DIO_u8PIN7, Active_High};
 
+/* LEDs of the light bar, in the order they light up as it gets darker */
+LED_T *const LightBar[LIGHT_BAR_LEDS] = {&LED1, &LED2, &LED3, &LED4, &LED5};
+
 BUZZER_T alarmBuzzer = {DIO_u8PORTB, DIO_u8PIN6, BUZZER_ACTIVE_HIGH};
 BUZZER_T buzzer = {DIO_u8PORTB, DIO_u8PIN6, BUZZER_ACTIVE_HIGH};
 
-ADC_info temp = {Vref_AVCC , RES_EIGHT_BITS};
+ADC_info temp = {Vref_INTERNAL , RES_TWELVE_BITS};	/* Auto-ranged scan results are in 2.56 V counts */
 
 u16 result[2] , Analog[2] = {0};
-u8 attemptCount = 0 , Channels[2] = {4 , 5};
+u8 attemptCount = 0;
+ADC_ScanChannel_t Channels[NUM_OF_CHANNELS] =
+{
+		/* LM35, 12-bit result, fan window */
+		{ADC_CH_ADC4 , ADC_OVERSAMPLING_X16 , ADC_MEDIAN_5 , 2u , TEMP_TO_COUNTS(FAN_OFF_TEMP) , TEMP_TO_COUNTS(FAN_ON_TEMP) , FAN_HYSTERESIS , TEMP_PERIOD , ADC_REF_AUTO},
+		/* LDR, 10-bit result, no window */
+		{ADC_CH_ADC5 , ADC_OVERSAMPLING_OFF , ADC_MEDIAN_3 , 2u , 0u , 0u , 0u , LIGHT_PERIOD}
+};
+const QUANT_Boundary_t LightBoundaries[NUM_OF_LIGHT_LVLS] PROGMEM =
+{
+		{LVL_0_LIGHT , LVL_HYSTERESIS(LVL_0_LIGHT)},
+		{LVL_1_LIGHT , LVL_HYSTERESIS(LVL_1_LIGHT)},
+		{LVL_2_LIGHT , LVL_HYSTERESIS(LVL_2_LIGHT)},
+		{LVL_3_LIGHT , LVL_HYSTERESIS(LVL_3_LIGHT)},
+		{LVL_4_LIGHT , LVL_HYSTERESIS(LVL_4_LIGHT)},
+		{LVL_5_LIGHT , LVL_HYSTERESIS(LVL_5_LIGHT)}
+};
+QUANT_t LightLevel;
 u8 Flag = 0u;
+u8 FanOn = 0u;
+volatile u8 FireAlarm = 0u;
+u8 CalibrationMode = 0u;
+char CalPassword[CAL_PASSWORD_LENGTH + 1u];
+u8 CalDigits = 0u;
 
 u8 fire[8] = 
 {
@@ -79,86 +143,58 @@ void main(void)
 	while(1)
 	{
 
-		/*Start ADC conversion*/
-		ADC_u8StartChainConvAsynch(NUM_OF_CHANNELS , Channels , result , GetNotification);
+		/*Read the latest ADC scan pass and react to window crossings*/
+		GetNotification();
+		HandleWindowEvents();
+		HandleCalibrationKeys();
 		CLCD_voidGoToXY(0,0);
 		CLCD_voidSendString("TEMP: ");
-		CLCD_voidDisplayNumber((u32) Analog[0]);
-		CLCD_voidSendString(" C");
-
+		CLCD_voidDisplayNumber((u32) (Analog[0] / 10u));
+		CLCD_voidSendData('.');
+		CLCD_voidDisplayNumber((u32) (Analog[0] % 10u));
+		CLCD_voidSendString(" C ");
+		CLCD_voidFlush();
+
+		/*The LM35 check works on every board; the comparator, when fitted, only raises the alarm sooner*/
+		if(Analog[0] > (FIRE_TEMP * 10u))
+		{
+			FireAlarm = 1u ;
+		}
 
-		if(Analog[0] > 50)
+		if(FireAlarm)
 		{
 			while(!Flag)
 			{
 				CLCD_voidGoToXY(0 ,0) ;
 				STEPPER_voidOn(STEPPER_HALF_STEP , STEPPER_CLOCK_WISE) ;
 				CLCD_voidSendString("FIRE DETECTED ") ;
-				CLCD_voidDisplaySpecialCharacter(fire , 0 , 0 , 15) ;
+				CLCD_voidDisplayGlyph(FIRE_GLYPH , fire , 0 , 15) ;
+				CLCD_voidFlush() ;
 				BUZZER_voidOn(buzzer) ;
 				EXTI_u8SetCallBack(INT2 ,&INIT2FUNC ) ;
 			}
 			CLCD_voidClearScreen() ;
 			Flag-- ;
+
+			/*Acknowledged: stay latched only while a sensor is still past the threshold*/
+#if FIRE_SENSOR_COMPARATOR == 1u
+			{
+				u8 SensorOutput ;
+
+				ACOMP_u8GetOutput(&SensorOutput) ;
+				FireAlarm = SensorOutput ;
+			}
+#else
+			FireAlarm = 0u ;
+#endif
 		}
-		else if(Analog[0] > 25)
+		else if(FanOn)
 		{
 			STEPPER_voidOn(STEPPER_HALF_STEP , STEPPER_CLOCK_WISE) ;
 		}
-		else if(Analog[0] < 23)
-		{
-			STEPPER_voidOff();
-		}
 
 
-		if(Analog[1] > LVL_0_LIGHT)
-		{
-			LED_voidOn(LED1);
-			LED_voidOn(LED2);
-			LED_voidOn(LED3);
-			LED_voidOn(LED4);
-			LED_voidOn(LED5);
-		}
-		else if(Analog[1] > LVL_1_LIGHT)
-		{
-			LED_voidOn(LED1);
-			LED_voidOn(LED2);
-			LED_voidOn(LED3);
-			LED_voidOn(LED4);
-			LED_voidOff(LED5);
-		}
-		else if(Analog[1] > LVL_2_LIGHT)
-		{
-			LED_voidOn(LED1);
-			LED_voidOn(LED2);
-			LED_voidOn(LED3);
-			LED_voidOff(LED4);
-			LED_voidOff(LED5);
-		}
-		else if(Analog[1] > LVL_3_LIGHT)
-		{
-			LED_voidOn(LED1);
-			LED_voidOn(LED2);
-			LED_voidOff(LED3);
-			LED_voidOff(LED4);
-			LED_voidOff(LED5);
-		}
-		else if(Analog[1] > LVL_4_LIGHT)
-		{
-			LED_voidOn(LED1);
-			LED_voidOff(LED2);
-			LED_voidOff(LED3);
-			LED_voidOff(LED4);
-			LED_voidOff(LED5);
-		}
-		else if(Analog[1] > LVL_5_LIGHT)
-		{
-			LED_voidOff(LED1);
-			LED_voidOff(LED2);
-			LED_voidOff(LED3);
-			LED_voidOff(LED4);
-			LED_voidOff(LED5);
-		}
+		UpdateLightBar();
 	}
 
 }
@@ -174,10 +210,16 @@ void main(void)
  * - LEDs (red, green, LED1, LED2, LED3, LED4, LED5)
  * - Buzzers (alarmBuzzer, buzzer)
  * - Stepper motor
- * - ADC for temperature and LDR readings
+ * - ADC for temperature and LDR readings, with the calibration stored in the EEPROM
+ * - Timer/Counter0 as the ADC sample clock, also counting the slots where the scan has nothing due
+ * - Timer/Counter2 as the LCD transmit tick (set up by CLCD_voidInit)
+ * - Analog comparator as a second fire detector, on boards built with FIRE_SENSOR_COMPARATOR
  * - External Interrupts (EXTI)
  * - Global Interrupts
  * 
+ * It then starts the ADC scan, which keeps converting the temperature and LDR channels
+ * in the background for the rest of the program, at most one conversion per Timer/Counter0 tick.
+ * 
  * @param None
  * @return void
  */
@@ -185,6 +227,9 @@ void Application_Initialization(void)
 {
     PORT_voidInit();
     CLCD_voidInit();
+#if MEASURE_LM35_CYCLES == 1u
+    MeasureLM35Cycles();
+#endif
     LED_voidInit(redLED);
     LED_voidInit(greenLED);
     LED_voidInit(LED1);
@@ -195,24 +240,338 @@ void Application_Initialization(void)
     BUZZER_voidInit(alarmBuzzer);
     STEPPER_voidInit();
     ADC_voidInit();
+    LoadCalibration();
+    QUANT_u8Init(&LightLevel , LightBoundaries , NUM_OF_LIGHT_LVLS);
+    TIMER0_u8SetCallBack(&ADC_voidScanTick);
+    TIMER0_voidInit();
+#if FIRE_SENSOR_COMPARATOR == 1u
+    /* PORT_config.h describes the original board: PB3 becomes the AIN1 input (LED2 on PA6 is set up above) */
+    DIO_u8_SetPinDirection(DIO_u8PORTB , DIO_u8PIN3 , DIO_u8PIN_INPUT);
+    ACOMP_u8SetCallBack(&FireAlarmISR);
+    ACOMP_voidInit();
+#endif
     EXTI_voidInit();
     GIE_voidEnableGlobal();
     BUZZER_voidInit(buzzer);
+    ADC_u8StartScan(NUM_OF_CHANNELS , Channels , NULL);
 }
 
 /**
  * @brief Retrieves temperature and LDR sensor values.
  * 
- * This function reads data from the LM35 temperature sensor and the LDR (Light Dependent Resistor)
- * and stores the results in global variables.
+ * This function takes a consistent snapshot of the last complete ADC scan pass for the LM35
+ * temperature sensor and the LDR (Light Dependent Resistor), converts them (the temperature to tenths
+ * of a degree, through the LM35 flash tables, and the light to lux, through the LDR tables) and stores the results in global variables. The values are left unchanged until a new pass has been published.
  * 
  * @param None
  * @return void
  */
 void GetNotification(void)
 {
-    LM35_getTemperature(&temp , result[0] , &Analog[0]);
-    Analog[1] = LDR_u16GetResistanceFrom8BitADC(result[1]);
+    static u8 LastSequence = 0u;
+    u8 Sequence;
+
+    /* Copy both channels from the same pass, and only convert when a new pass is available */
+    if((ADC_u8GetScanSnapshot(result , &Sequence) == NO_ERROR) && (Sequence != LastSequence))
+    {
+        LastSequence = Sequence;
+        LM35_u8GetTemperatureTenths(&temp , result[0] , &Analog[0]);
+        Analog[1] = LDR_u16GetLux(LDR_u16GetResistanceFrom10BitADC(result[1]));
+    }
+}
+
+/**
+ * @brief Updates the light bar from the light level.
+ * 
+ * This function quantises the latest light reading into the levels of LightBoundaries, with hysteresis
+ * so that a reading close to a boundary does not flicker the LEDs. When the level changes, only the
+ * LEDs between the old and the new bar length are switched: all five are on below LVL_0_LIGHT, one
+ * fewer for each level above it, and none from LVL_4_LIGHT up.
+ * 
+ * @param None
+ * @return void
+ */
+void UpdateLightBar(void)
+{
+    static u8 LitLeds = 0u;
+    u8 Level;
+    u8 Target;
+
+    Level = QUANT_u8Update(&LightLevel , Analog[1]);
+    if(Level != QUANT_NO_CHANGE)
+    {
+        Target = (Level < LIGHT_BAR_LEDS) ? (u8)(LIGHT_BAR_LEDS - Level) : 0u;
+        while(LitLeds < Target)
+        {
+            LED_voidOn(*LightBar[LitLeds]);
+            LitLeds++;
+        }
+        while(LitLeds > Target)
+        {
+            LitLeds--;
+            LED_voidOff(*LightBar[LitLeds]);
+        }
+    }
+}
+
+/**
+ * @brief Handles the ADC window events.
+ * 
+ * This function drains the window events posted by the ADC scan. The temperature channel has a window
+ * from FAN_OFF_TEMP to FAN_ON_TEMP: the fan is switched on when the temperature goes above the window
+ * and off when it goes below it, and keeps its state while the temperature stays inside.
+ * Nothing is done while no crossing has happened.
+ * 
+ * @param None
+ * @return void
+ */
+void HandleWindowEvents(void)
+{
+    ADC_WindowEvent_t Event;
+
+    while(ADC_u8GetWindowEvent(&Event) == NO_ERROR)
+    {
+        if(Event.Entry == 0u)
+        {
+            if(Event.Zone == ADC_ZONE_ABOVE)
+            {
+                FanOn = 1u;
+            }
+            else if(Event.Zone == ADC_ZONE_BELOW)
+            {
+                FanOn = 0u;
+                STEPPER_voidOff();
+            }
+        }
+    }
+}
+
+/**
+ * @brief Loads the ADC calibration from the EEPROM.
+ * 
+ * The record at CAL_EEPROM_ADDRESS holds CAL_EEPROM_MAGIC, the calibration of every scan entry and a
+ * checksum. If the record is valid, the calibration is applied to the scan entries; otherwise (blank
+ * EEPROM or corrupted record) they stay uncalibrated. It must be called after ADC_voidInit.
+ * 
+ * @param None
+ * @return void
+ */
+void LoadCalibration(void)
+{
+    ADC_Calibration_t Calibration[NUM_OF_CHANNELS];
+    u8 Magic = 0u;
+    u8 Checksum = 0u;
+    u8 Index;
+
+    if((EEPROM_u8ReadByte(CAL_EEPROM_ADDRESS , &Magic) == NO_ERROR) && (Magic == CAL_EEPROM_MAGIC) &&
+       (EEPROM_u8ReadBlock(CAL_EEPROM_ADDRESS + 1u , (u8*)Calibration , sizeof(Calibration)) == NO_ERROR) &&
+       (EEPROM_u8ReadByte(CAL_EEPROM_ADDRESS + 1u + sizeof(Calibration) , &Checksum) == NO_ERROR) &&
+       (Checksum == CalibrationChecksum((const u8*)Calibration , sizeof(Calibration))))
+    {
+        for(Index = 0u ; Index < NUM_OF_CHANNELS ; Index++)
+        {
+            ADC_u8SetCalibration(Index , &Calibration[Index]);
+        }
+    }
+}
+
+/**
+ * @brief Stores the ADC calibration in the EEPROM.
+ * 
+ * The calibration of every scan entry is written with its checksum, then the magic byte. Unchanged
+ * bytes are not rewritten. This blocks for about 8.5 ms per changed byte.
+ * 
+ * @param None
+ * @return void
+ */
+void StoreCalibration(void)
+{
+    ADC_Calibration_t Calibration[NUM_OF_CHANNELS];
+    u8 Index;
+
+    for(Index = 0u ; Index < NUM_OF_CHANNELS ; Index++)
+    {
+        ADC_u8GetCalibration(Index , &Calibration[Index]);
+    }
+
+    /* The magic byte goes last, so a reset while writing leaves a record the checksum rejects */
+    EEPROM_u8WriteBlock(CAL_EEPROM_ADDRESS + 1u , (const u8*)Calibration , sizeof(Calibration));
+    EEPROM_u8WriteByte(CAL_EEPROM_ADDRESS + 1u + sizeof(Calibration) , CalibrationChecksum((const u8*)Calibration , sizeof(Calibration)));
+    EEPROM_u8WriteByte(CAL_EEPROM_ADDRESS , CAL_EEPROM_MAGIC);
+}
+
+/**
+ * @brief Computes the checksum of the calibration record.
+ * 
+ * @param Data Bytes of the record.
+ * @param Length Number of bytes.
+ * @return u8 The two's complement of the byte sum, so a blank EEPROM (all 0xFF) never matches.
+ */
+u8 CalibrationChecksum(const u8* Data , u8 Length)
+{
+    u8 Sum = 0u;
+    u8 Index;
+
+    for(Index = 0u ; Index < Length ; Index++)
+    {
+        Sum += Data[Index];
+    }
+
+    return (u8)(~Sum + 1u);
+}
+
+/**
+ * @brief Runs the two-point calibration of the temperature channel from the keypad.
+ * 
+ * The calibration keys are password digits as well, so a stray press must not write the EEPROM: keys
+ * are first collected as a password, and only the right password enters calibration mode. In that mode,
+ * with the LM35 held at CAL_POINT1_TEMP, key CAL_POINT1_KEY captures the first point; with it held at
+ * CAL_POINT2_TEMP, key CAL_POINT2_KEY captures the second one. The ADC then corrects every temperature
+ * result (and the fan window) with the derived offset and gain, the calibration is stored in the
+ * EEPROM so it is loaded again at the next reset, and the mode ends. Any other key cancels the mode.
+ * 
+ * @param None
+ * @return void
+ */
+void HandleCalibrationKeys(void)
+{
+    u8 Key = KPD_u8GetPressedKey();
+
+    if(Key == KPD_NO_PRESSED_KEY)
+    {
+        /* Nothing to do */
+    }
+    else if(CalibrationMode == 0u)
+    {
+        /* Collect the password one key per pass, so the loop keeps running while it is typed */
+        CalPassword[CalDigits] = Key;
+        CalDigits++;
+        CLCD_voidGoToXY(1 , 0);
+        if(CalDigits < CAL_PASSWORD_LENGTH)
+        {
+            CLCD_voidSendString("CAL PASSWORD:   ");
+        }
+        else
+        {
+            CalPassword[CAL_PASSWORD_LENGTH] = '\0';
+            if(strcmp(CalPassword , PASSWORD) == 0)
+            {
+                CalibrationMode = 1u;
+                CLCD_voidSendString("3=PT1 4=PT2 1=NO");
+            }
+            else
+            {
+                CLCD_voidSendString("WRONG PASSWORD  ");
+            }
+            CalDigits = 0u;
+        }
+    }
+    else if(Key == CAL_POINT1_KEY)
+    {
+        CLCD_voidGoToXY(1 , 0);
+        if(ADC_u8CalibratePoint(0u , ADC_CAL_POINT_1 , TEMP_TO_COUNTS(CAL_POINT1_TEMP)) == NO_ERROR)
+        {
+            CLCD_voidSendString("CAL POINT 1 OK  ");
+        }
+        else
+        {
+            CLCD_voidSendString("CAL NOT READY   ");
+        }
+    }
+    else if(Key == CAL_POINT2_KEY)
+    {
+        CLCD_voidGoToXY(1 , 0);
+        if(ADC_u8CalibratePoint(0u , ADC_CAL_POINT_2 , TEMP_TO_COUNTS(CAL_POINT2_TEMP)) == NO_ERROR)
+        {
+            StoreCalibration();
+            CalibrationMode = 0u;
+            CLCD_voidSendString("CAL SAVED       ");
+        }
+        else
+        {
+            CLCD_voidSendString("CAL FAILED      ");
+        }
+    }
+    else
+    {
+        /* Any other key leaves calibration mode without touching the EEPROM */
+        CalibrationMode = 0u;
+        CLCD_voidGoToXY(1 , 0);
+        CLCD_voidSendString("CAL CANCELLED   ");
+    }
+}
+
+#if MEASURE_LM35_CYCLES == 1u
+/**
+ * @brief Times the LM35 conversion paths and shows the results on the LCD.
+ * 
+ * Each path is timed over MEASURE_SAMPLES readings spread over its input range, one Timer/Counter1
+ * bracket per call, and the cost of an empty bracket is taken off the average. The 32-bit path is
+ * reached with a reference that has no table, 2.5 V; it is the previous conversion. Interrupts are
+ * still off at this point of the initialisation, so no ISR is counted.
+ * 
+ * @param None
+ * @return void
+ */
+void MeasureLM35Cycles(void)
+{
+    ADC_info Paths[3] =
+    {
+            {2500u , RES_TWELVE_BITS},			/* No table: 32-bit multiply and divide */
+            {Vref_INTERNAL , RES_EIGHT_BITS},	/* 8-bit table lookup */
+            {Vref_INTERNAL , RES_TWELVE_BITS}	/* 12-bit interpolation */
+    };
+    const u16 InputStep[3] = {4095u / MEASURE_SAMPLES , 255u / MEASURE_SAMPLES , 4095u / MEASURE_SAMPLES};
+    u32 Cycles[3] = {0u , 0u , 0u};
+    u16 Overhead;
+    u16 Tenths;
+    u8 Path;
+    u8 Sample;
+
+    TIMER1_voidStartCycleCounter();
+    Overhead = TIMER1_u16GetCycles();
+
+    for(Path = 0u ; Path < 3u ; Path++)
+    {
+        for(Sample = 0u ; Sample < MEASURE_SAMPLES ; Sample++)
+        {
+            TIMER1_voidStartCycleCounter();
+            LM35_u8GetTemperatureTenths(&Paths[Path] , (u16)(Sample * InputStep[Path]) , &Tenths);
+            Cycles[Path] += (u32)(TIMER1_u16GetCycles() - Overhead);
+        }
+    }
+
+    CLCD_voidGoToXY(0 , 0);
+    CLCD_voidSendString("OLD ");
+    CLCD_voidDisplayNumber(Cycles[0] / MEASURE_SAMPLES);
+    CLCD_voidSendString(" 8B ");
+    CLCD_voidDisplayNumber(Cycles[1] / MEASURE_SAMPLES);
+    CLCD_voidGoToXY(1 , 0);
+    CLCD_voidSendString("12B ");
+    CLCD_voidDisplayNumber(Cycles[2] / MEASURE_SAMPLES);
+    CLCD_voidFlush();
+    CLCD_voidWaitQueue();	/* Interrupts are still off: the Timer/Counter2 tick cannot send the queue */
+    _delay_ms(10000);
+    CLCD_voidClearScreen();
+}
+#endif
+
+/**
+ * @brief Analog comparator callback function to raise the fire alarm.
+ * 
+ * Only used on boards built with FIRE_SENSOR_COMPARATOR. The fire sensor divider on AIN1 (PB3)
+ * falls below the internal bandgap reference at the fire temperature. This function is called from
+ * the comparator interrupt on that edge: it switches the buzzer on and latches the alarm at once,
+ * whatever the main loop is doing. The main loop shows the alarm and clears the latch once it is
+ * acknowledged on INT2.
+ * 
+ * @param None
+ * @return void
+ */
+void FireAlarmISR(void)
+{
+    BUZZER_voidOn(buzzer);
+    FireAlarm = 1u;
 }
 
 /**
@@ -250,6 +609,7 @@ void handlePassword(void)
     while (attemptCount < MAX_ATTEMPTS) 
 	{
         CLCD_voidSendString("Enter Password:");
+        CLCD_voidFlush();
 
         for (i = 0; i < 2; i++) 
 		{
@@ -270,6 +630,7 @@ void handlePassword(void)
                     CLCD_voidGoToXY(1, 0);
                 }
                 CLCD_voidSendData(key);
+                CLCD_voidFlush();
                 _delay_ms(200);
             }
         }
@@ -280,6 +641,7 @@ void handlePassword(void)
 		{
             CLCD_voidClearScreen();
             CLCD_voidSendString("Welcome Home");
+            CLCD_voidFlush();
             LED_voidOn(greenLED);
             openDoor();
             _delay_ms(3000);
@@ -292,6 +654,7 @@ void handlePassword(void)
 		{
             CLCD_voidClearScreen();
             CLCD_voidSendString("Wrong Password");
+            CLCD_voidFlush();
             LED_voidOn(redLED);
             _delay_ms(1000);
             LED_voidOff(redLED);
@@ -301,6 +664,7 @@ void handlePassword(void)
             if (attemptCount >= MAX_ATTEMPTS) 
 			{
                 CLCD_voidSendString("Too Many Attempts");
+                CLCD_voidFlush();
                 BUZZER_voidOn(alarmBuzzer);
                 blinkRedLED();
                 BUZZER_voidOff(alarmBuzzer);
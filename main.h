@@ -25,11 +25,16 @@
 #include "DIO_interface.h"
 #include "GIE_interface.h"
 #include "ADC_interface.h"
+#include "TIMER_interface.h"
+#include "ACOMP_interface.h"
+#include "EEPROM_interface.h"
 
 #include "STD_types.h"
+#include "quant.h"
 
 #include <string.h>
 #include <util/delay.h>
+#include <avr/pgmspace.h>
 
 /*Include Section End*/
 
@@ -38,14 +43,113 @@
 /**
  * @brief Retrieves temperature and LDR sensor values.
  * 
- * This function reads data from the LM35 temperature sensor and the LDR (Light Dependent Resistor)
- * and stores the results in global variables.
+ * This function takes a consistent snapshot of the last complete ADC scan pass for the LM35
+ * temperature sensor and the LDR (Light Dependent Resistor), converts them (the temperature to tenths
+ * of a degree, through the LM35 flash tables, and the light to lux, through the LDR tables) and stores the results in global variables. The values are left unchanged until a new pass has been published.
  * 
  * @param None
  * @return void
  */
 void GetNotification(void);
 
+/**
+ * @brief Updates the light bar from the light level.
+ * 
+ * This function quantises the latest light reading into the levels of LightBoundaries, with hysteresis
+ * so that a reading close to a boundary does not flicker the LEDs. When the level changes, only the
+ * LEDs between the old and the new bar length are switched: all five are on below LVL_0_LIGHT, one
+ * fewer for each level above it, and none from LVL_4_LIGHT up.
+ * 
+ * @param None
+ * @return void
+ */
+void UpdateLightBar(void);
+
+/**
+ * @brief Handles the ADC window events.
+ * 
+ * This function drains the window events posted by the ADC scan. The temperature channel has a window
+ * from FAN_OFF_TEMP to FAN_ON_TEMP: the fan is switched on when the temperature goes above the window
+ * and off when it goes below it, and keeps its state while the temperature stays inside.
+ * Nothing is done while no crossing has happened.
+ * 
+ * @param None
+ * @return void
+ */
+void HandleWindowEvents(void);
+
+/**
+ * @brief Loads the ADC calibration from the EEPROM.
+ * 
+ * The record at CAL_EEPROM_ADDRESS holds CAL_EEPROM_MAGIC, the calibration of every scan entry and a
+ * checksum. If the record is valid, the calibration is applied to the scan entries; otherwise (blank
+ * EEPROM or corrupted record) they stay uncalibrated. It must be called after ADC_voidInit.
+ * 
+ * @param None
+ * @return void
+ */
+void LoadCalibration(void);
+
+/**
+ * @brief Stores the ADC calibration in the EEPROM.
+ * 
+ * The calibration of every scan entry is written with its checksum, then the magic byte. Unchanged
+ * bytes are not rewritten. This blocks for about 8.5 ms per changed byte.
+ * 
+ * @param None
+ * @return void
+ */
+void StoreCalibration(void);
+
+/**
+ * @brief Computes the checksum of the calibration record.
+ * 
+ * @param Data Bytes of the record.
+ * @param Length Number of bytes.
+ * @return u8 The two's complement of the byte sum, so a blank EEPROM (all 0xFF) never matches.
+ */
+u8 CalibrationChecksum(const u8* Data , u8 Length);
+
+/**
+ * @brief Runs the two-point calibration of the temperature channel from the keypad.
+ * 
+ * The calibration keys are password digits as well, so a stray press must not write the EEPROM: keys
+ * are first collected as a password, and only the right password enters calibration mode. In that mode,
+ * with the LM35 held at CAL_POINT1_TEMP, key CAL_POINT1_KEY captures the first point; with it held at
+ * CAL_POINT2_TEMP, key CAL_POINT2_KEY captures the second one. The ADC then corrects every temperature
+ * result (and the fan window) with the derived offset and gain, the calibration is stored in the
+ * EEPROM so it is loaded again at the next reset, and the mode ends. Any other key cancels the mode.
+ * 
+ * @param None
+ * @return void
+ */
+void HandleCalibrationKeys(void);
+
+/**
+ * @brief Times the LM35 conversion paths and shows the results on the LCD.
+ * 
+ * Only built with MEASURE_LM35_CYCLES. Each path is timed with Timer/Counter1 over a sweep of its
+ * input range, and the average cycles per reading are shown for 10 seconds.
+ * 
+ * @param None
+ * @return void
+ */
+void MeasureLM35Cycles(void);
+
+/**
+ * @brief Analog comparator callback function to raise the fire alarm.
+ * 
+ * Only used on boards built with FIRE_SENSOR_COMPARATOR. The fire sensor divider on AIN1 (PB3)
+ * falls below the internal bandgap reference at the fire temperature. This function is called from
+ * the comparator interrupt on that edge: it switches the buzzer on and latches the alarm at once,
+ * whatever the main loop is doing. The main loop shows the alarm and clears the latch once it is
+ * acknowledged on INT2.
+ * 
+ * @param None
+ * @return void
+ */
+void FireAlarmISR(void);
+
 /**
  * @brief Interrupt callback function to turn off the buzzer.
  * 
@@ -108,10 +212,16 @@ void handlePassword(void) ;
  * - LEDs (red, green, LED1, LED2, LED3, LED4, LED5)
  * - Buzzers (alarmBuzzer, buzzer)
  * - Stepper motor
- * - ADC for temperature and LDR readings
+ * - ADC for temperature and LDR readings, with the calibration stored in the EEPROM
+ * - Timer/Counter0 as the ADC sample clock, also counting the slots where the scan has nothing due
+ * - Timer/Counter2 as the LCD transmit tick (set up by CLCD_voidInit)
+ * - Analog comparator as a second fire detector, on boards built with FIRE_SENSOR_COMPARATOR
  * - External Interrupts (EXTI)
  * - Global Interrupts
  * 
+ * It then starts the ADC scan, which keeps converting the temperature and LDR channels
+ * in the background for the rest of the program, at most one conversion per Timer/Counter0 tick.
+ * 
  * @param None
  * @return void
  */